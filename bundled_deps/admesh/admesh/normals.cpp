@@ -29,6 +29,9 @@
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
 
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_reduce.h>
+
 #include "stl.h"
 
 static void reverse_facet(stl_file *stl, int facet_num)
@@ -221,14 +224,42 @@ void stl_fix_normal_directions(stl_file *stl)
 	// pool.destroy(tail);
 }
 
+// Recalculate the normal of a single facet from its vertices.
+// Returns true if the stored normal was off and had to be fixed,
+// equivalent to check_normal_vector(stl, facet_num, 1) except that the
+// stats counter is left to the caller, which makes the facets independent.
+static bool fix_normal_value(stl_file *stl, uint32_t facet_num)
+{
+	stl_facet *facet = &stl->facet_start[facet_num];
+
+	stl_normal normal;
+	stl_calculate_normal(normal, facet);
+	stl_normalize_vector(normal);
+	stl_normal normal_dif = (normal - facet->normal).cwiseAbs();
+
+	const float eps = 0.001f;
+	bool fixed = ! (normal_dif(0) < eps && normal_dif(1) < eps && normal_dif(2) < eps);
+	facet->normal = normal;
+	return fixed;
+}
+
 void stl_fix_normal_values(stl_file *stl)
 {
-	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i)
-    	check_normal_vector(stl, i, 1);
+	// Each facet only reads and writes its own data, recalculate the normals in parallel.
+	stl->stats.normals_fixed += tbb::parallel_reduce(
+		tbb::blocked_range<uint32_t>(0, stl->stats.number_of_facets), 0,
+		[stl](const tbb::blocked_range<uint32_t> &range, int fixed) {
+			for (uint32_t i = range.begin(); i < range.end(); ++ i)
+				if (fix_normal_value(stl, i))
+					++ fixed;
+			return fixed;
+		},
+		[](int a, int b) { return a + b; });
 }
 
 void stl_reverse_all_facets(stl_file *stl)
 {
+	// Cannot be parallelized, reverse_facet() also updates the neighbor records.
 	stl_normal normal;
   	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i) {
     	reverse_facet(stl, i);
@@ -26,6 +26,9 @@
 #include <math.h>
 #include <assert.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/predef/other/endian.h>
@@ -147,24 +150,43 @@ static FILE* stl_open_count_facets(stl_file *stl, const char *file)
    time running this for the stl and therefore we should reset our max and min stats. */
 static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first)
 {
-	if (stl->stats.type == binary)
+	if (stl->stats.type == binary) {
     	fseek(fp, HEADER_SIZE, SEEK_SET);
-  	else
-    	rewind(fp);
+
+		// Read the facets in bulk. The binary facet records are SIZEOF_STL_FACET
+		// bytes tightly packed, while the in-memory stl_facet is padded, thus the
+		// records are copied out of a chunk buffer one by one. Reading record by
+		// record with fread is dominated by the libc call overhead on big files.
+		std::vector<char> chunk(size_t(SIZEOF_STL_FACET) * 4096);
+		for (uint32_t i = first_facet; i < stl->stats.number_of_facets;) {
+			size_t n = std::min(size_t(stl->stats.number_of_facets - i), chunk.size() / SIZEOF_STL_FACET);
+			if (fread(chunk.data(), SIZEOF_STL_FACET, n, fp) != n)
+				return false;
+			for (size_t j = 0; j < n; ++ j, ++ i) {
+				stl_facet facet;
+				memcpy(&facet, chunk.data() + j * SIZEOF_STL_FACET, SIZEOF_STL_FACET);
+#if BOOST_ENDIAN_BIG_BYTE
+				// Convert the loaded little endian data to big endian.
+				stl_internal_reverse_quads((char*)&facet, 48);
+#endif /* BOOST_ENDIAN_BIG_BYTE */
+				// Write the facet into memory.
+				stl->facet_start[i] = facet;
+				stl_facet_stats(stl, facet, first);
+			}
+		}
+
+		stl->stats.size = stl->stats.max - stl->stats.min;
+		stl->stats.bounding_diameter = stl->stats.size.norm();
+		return true;
+	}
+
+   	rewind(fp);
 
   	char normal_buf[3][32];
   	for (uint32_t i = first_facet; i < stl->stats.number_of_facets; ++ i) {
   	  	stl_facet facet;
 
-    	if (stl->stats.type == binary) {
-      		// Read a single facet from a binary .STL file. We assume little-endian architecture!
-      		if (fread(&facet, 1, SIZEOF_STL_FACET, fp) != SIZEOF_STL_FACET)
-      			return false;
-#if BOOST_ENDIAN_BIG_BYTE
-      		// Convert the loaded little endian data to big endian.
-      		stl_internal_reverse_quads((char*)&facet, 48);
-#endif /* BOOST_ENDIAN_BIG_BYTE */
-    	} else {
+    	{
 			// Read a single facet from an ASCII .STL file
 			// skip solid/endsolid
 			// (in this order, otherwise it won't work when they are paired in the middle of a file)
@@ -27,43 +27,51 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_reduce.h>
+
 #include "stl.h"
 
 void stl_verify_neighbors(stl_file *stl)
 {
-	stl->stats.backwards_edges = 0;
-
-	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i) {
-		for (int j = 0; j < 3; ++ j) {
-			struct stl_edge {
-				stl_vertex p1;
-				stl_vertex p2;
-				int        facet_number;
-			};
-			stl_edge edge_a;
-			edge_a.p1 = stl->facet_start[i].vertex[j];
-			edge_a.p2 = stl->facet_start[i].vertex[(j + 1) % 3];
-			int neighbor = stl->neighbors_start[i].neighbor[j];
-			if (neighbor == -1)
-				continue; // this edge has no neighbor... Continue.
-			int vnot = stl->neighbors_start[i].which_vertex_not[j];
-			stl_edge edge_b;
-			if (vnot < 3) {
-				edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
-				edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
-			} else {
-				stl->stats.backwards_edges += 1;
-				edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
-				edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
+	// The verification only reads the facets, count the backwards edges in parallel.
+	stl->stats.backwards_edges = tbb::parallel_reduce(
+		tbb::blocked_range<uint32_t>(0, stl->stats.number_of_facets), 0,
+		[stl](const tbb::blocked_range<uint32_t> &range, int backwards_edges) {
+			for (uint32_t i = range.begin(); i < range.end(); ++ i) {
+				for (int j = 0; j < 3; ++ j) {
+					struct stl_edge {
+						stl_vertex p1;
+						stl_vertex p2;
+						int        facet_number;
+					};
+					stl_edge edge_a;
+					edge_a.p1 = stl->facet_start[i].vertex[j];
+					edge_a.p2 = stl->facet_start[i].vertex[(j + 1) % 3];
+					int neighbor = stl->neighbors_start[i].neighbor[j];
+					if (neighbor == -1)
+						continue; // this edge has no neighbor... Continue.
+					int vnot = stl->neighbors_start[i].which_vertex_not[j];
+					stl_edge edge_b;
+					if (vnot < 3) {
+						edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
+						edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
+					} else {
+						backwards_edges += 1;
+						edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
+						edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
+					}
+					if (edge_a.p1 != edge_b.p1 || edge_a.p2 != edge_b.p2) {
+						// These edges should match but they don't.  Print results.
+						BOOST_LOG_TRIVIAL(info) << "edge " << j << " of facet " << i << " doesn't match edge " << (vnot + 1) << " of facet " << neighbor;
+						stl_write_facet(stl, (char*)"first facet", i);
+						stl_write_facet(stl, (char*)"second facet", neighbor);
+					}
+				}
 			}
-			if (edge_a.p1 != edge_b.p1 || edge_a.p2 != edge_b.p2) {
-				// These edges should match but they don't.  Print results.
-				BOOST_LOG_TRIVIAL(info) << "edge " << j << " of facet " << i << " doesn't match edge " << (vnot + 1) << " of facet " << neighbor;
-				stl_write_facet(stl, (char*)"first facet", i);
-				stl_write_facet(stl, (char*)"second facet", neighbor);
-			}
-		}
-	}
+			return backwards_edges;
+		},
+		[](int a, int b) { return a + b; });
 }
 
 void stl_translate(stl_file *stl, float x, float y, float z)
@@ -1,4 +1,6 @@
 #include <cstdio>
+#include <ctime>
+#include <map>
 #include <string>
 #include <cstring>
 #include <iostream>
@@ -116,6 +118,30 @@ static bool load_print_config(DynamicPrintConfig &print_config, PrinterTechnolog
     return true;
 }
 
+// Geometry cache for the batch mode: the jobs often slice the same model with different settings,
+// thus reuse the parsed model as long as the file has not changed since the last job.
+static Model load_model_cached(const std::string& file, bool batch_mode)
+{
+    if (!batch_mode)
+        return FileReader::load_model(file);
+
+    struct CachedModel {
+        std::time_t             mtime;
+        boost::uintmax_t        size;
+        Model                   model;
+    };
+    static std::map<std::string, CachedModel> cache;
+
+    const std::time_t      mtime = boost::filesystem::last_write_time(file);
+    const boost::uintmax_t size  = boost::filesystem::file_size(file);
+    if (auto it = cache.find(file); it != cache.end() && it->second.mtime == mtime && it->second.size == size)
+        return it->second.model;
+
+    Model model = FileReader::load_model(file);
+    cache[file] = CachedModel{ mtime, size, model };
+    return model;
+}
+
 static bool process_input_files(std::vector<Model>& models, DynamicPrintConfig& print_config, PrinterTechnology& printer_technology, Data& cli)
 {
     for (const std::string& file : cli.input_files) {
@@ -132,7 +158,7 @@ static bool process_input_files(std::vector<Model>& models, DynamicPrintConfig&
             if (has_full_config_from_profiles(cli) || !FileReader::is_project_file(file)) {
                 // we have full banch of options from profiles set
                 // so, just load a geometry
-                model = FileReader::load_model(file);
+                model = load_model_cached(file, cli.misc_config.has("batch") && cli.misc_config.opt_bool("batch"));
             }
             else {
                 // load model and configuration from the file
@@ -1,8 +1,11 @@
+#include <atomic>
 #include <cstdio>
+#include <memory>
 #include <string>
 #include <cstring>
 #include <iostream>
 #include <math.h>
+#include <thread>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/nowide/args.hpp>
@@ -335,6 +338,16 @@ bool process_actions(Data& cli, const DynamicPrintConfig& print_config, std::vec
         arr2::ArrangeSettings   arrange_cfg;
         arrange_cfg.set_distance_from_objects(min_object_distance(print_config));
 
+        // The prints are prepared serially: arrange and apply mutate the model and the shared
+        // multiple beds state, so only the processing and the export below may run concurrently.
+        struct PreparedPrint {
+            std::unique_ptr<Print>      fff_print;
+            std::unique_ptr<SLAPrint>   sla_print;
+            PrintBase*                  print;
+        };
+        std::vector<PreparedPrint> prepared;
+        prepared.reserve(models.size());
+
         for (Model& model : models) {
             // If all objects have defined instances, their relative positions will be
             // honored when printing (they will be only centered, unless --dont-arrange
@@ -349,52 +362,57 @@ bool process_actions(Data& cli, const DynamicPrintConfig& print_config, std::vec
                     arrange_objects(model, bed, arrange_cfg);
             }
 
-            Print       fff_print;
-            SLAPrint    sla_print;
-            sla_print.set_status_callback( [](const PrintBase::SlicingStatus& s) {
+            PreparedPrint pp;
+            pp.fff_print = std::make_unique<Print>();
+            pp.sla_print = std::make_unique<SLAPrint>();
+            pp.sla_print->set_status_callback( [](const PrintBase::SlicingStatus& s) {
                 if (s.percent >= 0) { // FIXME: is this sufficient?
                     printf("%3d%s %s\n", s.percent, "% =>", s.text.c_str());
                     std::fflush(stdout);
                 }
             });
 
-            PrintBase* print = (printer_technology == ptFFF) ? static_cast<PrintBase*>(&fff_print) : static_cast<PrintBase*>(&sla_print);
+            pp.print = (printer_technology == ptFFF) ? static_cast<PrintBase*>(pp.fff_print.get()) : static_cast<PrintBase*>(pp.sla_print.get());
             if (printer_technology == ptFFF) {
                 for (auto* mo : model.objects)
-                    fff_print.auto_assign_extruders(mo);
+                    pp.fff_print->auto_assign_extruders(mo);
             }
 
             update_instances_outside_state(model, print_config);
-            MultipleBedsUtils::with_single_bed_model_fff(model, 0, [&print, &model, &print_config]()
+            MultipleBedsUtils::with_single_bed_model_fff(model, 0, [&pp, &model, &print_config]()
             {
-                print->apply(model, print_config);
+                pp.print->apply(model, print_config);
             });
 
-            std::string err = print->validate();
+            std::string err = pp.print->validate();
             if (!err.empty()) {
                 boost::nowide::cerr << err << std::endl;
                 return 1;
             }
 
-            std::string outfile = output;
-
-            if (print->empty())
-                boost::nowide::cout << "Nothing to print for " << outfile << " . Either the print is empty or no object is fully inside the print volume." << std::endl;
+            if (pp.print->empty())
+                boost::nowide::cout << "Nothing to print for " << output << " . Either the print is empty or no object is fully inside the print volume." << std::endl;
             else
-                try {
+                prepared.emplace_back(std::move(pp));
+        }
+
+        // Slice one prepared print and write its output as soon as it finishes.
+        auto slice_and_export = [&output, printer_technology](PreparedPrint& pp) -> bool {
+            std::string outfile = output;
+            try {
                 std::string outfile_final;
-                print->process();
+                pp.print->process();
                 if (printer_technology == ptFFF) {
                     // The outfile is processed by a PlaceholderParser.
-                    const std::string input_file = fff_print.model().objects.empty() ? "" : fff_print.model().objects.front()->input_file;
-                    outfile = fff_print.export_gcode(outfile, nullptr, get_thumbnail_generator_cli(input_file));
-                    outfile_final = fff_print.print_statistics().finalize_output_path(outfile);
+                    const std::string input_file = pp.fff_print->model().objects.empty() ? "" : pp.fff_print->model().objects.front()->input_file;
+                    outfile = pp.fff_print->export_gcode(outfile, nullptr, get_thumbnail_generator_cli(input_file));
+                    outfile_final = pp.fff_print->print_statistics().finalize_output_path(outfile);
                 }
                 else {
-                    outfile = sla_print.output_filepath(outfile);
+                    outfile = pp.sla_print->output_filepath(outfile);
                     // We need to finalize the filename beforehand because the export function sets the filename inside the zip metadata
-                    outfile_final = sla_print.print_statistics().finalize_output_path(outfile);
-                    sla_print.export_print(outfile_final);
+                    outfile_final = pp.sla_print->print_statistics().finalize_output_path(outfile);
+                    pp.sla_print->export_print(outfile_final);
                 }
                 if (outfile != outfile_final) {
                     if (Slic3r::rename_file(outfile, outfile_final)) {
@@ -404,14 +422,43 @@ bool process_actions(Data& cli, const DynamicPrintConfig& print_config, std::vec
                     outfile = outfile_final;
                 }
                 // Run the post-processing scripts if defined.
-                run_post_process_scripts(outfile, fff_print.full_print_config());
+                run_post_process_scripts(outfile, pp.fff_print->full_print_config());
                 boost::nowide::cout << "Slicing result exported to " << outfile << std::endl;
             }
             catch (const std::exception& ex) {
                 boost::nowide::cerr << ex.what() << std::endl;
                 return false;
             }
+            return true;
+        };
 
+        size_t jobs = 1;
+        if (cli.misc_config.has("slicing_jobs"))
+            jobs = size_t(std::max(1, cli.misc_config.opt_int("slicing_jobs")));
+        jobs = std::min(jobs, std::max(prepared.size(), size_t(1)));
+
+        if (jobs <= 1) {
+            for (PreparedPrint& pp : prepared)
+                if (!slice_and_export(pp))
+                    return false;
+        } else {
+            // Slice independent plates concurrently. Each job runs a whole Print pipeline,
+            // the inner TBB parallelism of the pipelines composes within the shared thread
+            // pool, so the large plates still use all the cores when few jobs remain.
+            std::atomic<size_t> next_print{ 0 };
+            std::atomic<bool>   failed{ false };
+            std::vector<std::thread> workers;
+            workers.reserve(jobs);
+            for (size_t i = 0; i < jobs; ++ i)
+                workers.emplace_back([&prepared, &next_print, &failed, &slice_and_export]() {
+                    for (size_t idx = next_print ++; idx < prepared.size(); idx = next_print ++)
+                        if (!slice_and_export(prepared[idx]))
+                            failed.store(true);
+                });
+            for (std::thread& worker : workers)
+                worker.join();
+            if (failed.load())
+                return false;
         }
     }
 
@@ -1,8 +1,98 @@
+#include <boost/nowide/iostream.hpp>
+
 #include "../PrusaSlicer.hpp"
 #include "CLI.hpp"
 
 namespace Slic3r::CLI {
 
+// Non-interactive part of a single slicing job: load the models and the configuration,
+// apply the transformations and execute the requested actions.
+static int run_job(Data& cli)
+{
+    PrinterTechnology   printer_technology = get_printer_technology(cli.overrides_config);
+    DynamicPrintConfig  print_config       = {};
+    std::vector<Model>  models;
+
+    if (!load_print_data(models, print_config, printer_technology, cli))
+        return 1;
+
+    if (is_needed_post_processing(print_config))
+        return 0;
+
+    if (!process_transform(cli, print_config, models))
+        return 1;
+
+    if (!process_actions(cli, print_config, models))
+        return 1;
+
+    return 0;
+}
+
+// Split a batch job line into command line arguments. Double quotes protect spaces in paths.
+static std::vector<std::string> split_job_line(const std::string& line)
+{
+    std::vector<std::string> args;
+    std::string current;
+    bool in_quotes = false;
+    bool has_token = false;
+    for (char c : line) {
+        if (c == '"') {
+            in_quotes = !in_quotes;
+            has_token = true;
+        } else if (!in_quotes && (c == ' ' || c == '\t')) {
+            if (has_token) {
+                args.emplace_back(std::move(current));
+                current.clear();
+                has_token = false;
+            }
+        } else {
+            current += c;
+            has_token = true;
+        }
+    }
+    if (has_token)
+        args.emplace_back(std::move(current));
+    return args;
+}
+
+// Batch slicing mode: keep the warm process alive and accept further jobs on the standard input,
+// one per line with the same syntax as the command line arguments. Parsed models are cached
+// between the jobs (see load_print_data()). After each job one status line "done code=N" is
+// written to the standard output for the dispatcher feeding the jobs. Terminated by "exit",
+// "quit" or the end of the input.
+static int run_batch()
+{
+    boost::nowide::cout << "batch mode: reading jobs from the standard input" << std::endl;
+    std::string line;
+    while (std::getline(boost::nowide::cin, line)) {
+        if (line.empty() || line.front() == '#')
+            continue;
+        if (line == "exit" || line == "quit")
+            break;
+
+        std::vector<std::string> args = split_job_line(line);
+        std::string program_name = "prusa-slicer";
+        std::vector<char*> argv;
+        argv.push_back(program_name.data());
+        for (std::string& arg : args)
+            argv.push_back(arg.data());
+
+        int code = 1;
+        try {
+            Data job;
+            if (setup(job, int(argv.size()), argv.data()) && !process_profiles_sharing(job)) {
+                // Keep the model cache active for the jobs.
+                job.misc_config.set_key_value("batch", new ConfigOptionBool(true));
+                code = run_job(job);
+            }
+        } catch (const std::exception& e) {
+            boost::nowide::cerr << e.what() << std::endl;
+        }
+        boost::nowide::cout << "done code=" << code << std::endl;
+    }
+    return 0;
+}
+
 int run(int argc, char** argv)
 {
     Data cli;
@@ -12,6 +102,13 @@ int run(int argc, char** argv)
     if (process_profiles_sharing(cli))
         return 1;
 
+    if (cli.misc_config.has("batch") && cli.misc_config.opt_bool("batch")) {
+        // Process the job given on the command line (if any), then keep accepting jobs on the standard input.
+        if (!cli.empty())
+            boost::nowide::cout << "done code=" << run_job(cli) << std::endl;
+        return run_batch();
+    }
+
     bool                start_gui          = cli.empty() || (cli.actions_config.empty() && !cli.transform_config.has("cut"));
     PrinterTechnology   printer_technology = get_printer_technology(cli.overrides_config);
     DynamicPrintConfig  print_config       = {};
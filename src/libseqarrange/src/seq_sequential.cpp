@@ -9,6 +9,8 @@
  */
 /*================================================================*/
 
+#include <limits>
+
 #include <libslic3r/SVG.hpp>
 #include <libslic3r/Geometry/ConvexHull.hpp>
 
@@ -6468,8 +6470,78 @@ bool refine_ConsequentialPolygonWeakNonoverlapping(z3::solver
 
 /*----------------------------------------------------------------*/
 
+/* Axis-aligned bounding boxes of the placed object polygons and of their
+   unreachable zones. Pairs of objects whose boxes do not overlap cannot
+   produce a conflict, hence the pairwise checks below skip them. */
+
+struct PlacedObjectBox
+{
+    double min_x, min_y, max_x, max_y;
+
+    bool overlaps(const PlacedObjectBox &other) const
+    {
+	return (   min_x <= other.max_x && other.min_x <= max_x
+		&& min_y <= other.max_y && other.min_y <= max_y);
+    }
+};
+
+
+static void collect_PlacedObjectBoxes(const std::vector<Rational>                      &dec_values_X,
+				      const std::vector<Rational>                      &dec_values_Y,
+				      const std::vector<Slic3r::Polygon>               &polygons,
+				      const std::vector<std::vector<Slic3r::Polygon> > &unreachable_polygons,
+				      std::vector<PlacedObjectBox>                     &polygon_boxes,
+				      std::vector<PlacedObjectBox>                     &unreachable_boxes)
+{
+    const double init_min = std::numeric_limits<double>::max();
+    const double init_max = -std::numeric_limits<double>::max();
+
+    for (unsigned int i = 0; i < polygons.size(); ++i)
+    {
+	double X = dec_values_X[i].as_double();
+	double Y = dec_values_Y[i].as_double();
+
+	PlacedObjectBox polygon_box{ init_min, init_min, init_max, init_max };
+
+	for (unsigned int p = 0; p < polygons[i].points.size(); ++p)
+	{
+	    const Point &point = polygons[i].points[p];
+
+	    polygon_box.min_x = MIN(polygon_box.min_x, X + point.x());
+	    polygon_box.min_y = MIN(polygon_box.min_y, Y + point.y());
+	    polygon_box.max_x = MAX(polygon_box.max_x, X + point.x());
+	    polygon_box.max_y = MAX(polygon_box.max_y, Y + point.y());
+	}
+	polygon_boxes.push_back(polygon_box);
+
+	PlacedObjectBox unreachable_box{ init_min, init_min, init_max, init_max };
+
+	for (unsigned int poly = 0; poly < unreachable_polygons[i].size(); ++poly)
+	{
+	    for (unsigned int p = 0; p < unreachable_polygons[i][poly].points.size(); ++p)
+	    {
+		const Point &point = unreachable_polygons[i][poly].points[p];
+
+		unreachable_box.min_x = MIN(unreachable_box.min_x, X + point.x());
+		unreachable_box.min_y = MIN(unreachable_box.min_y, Y + point.y());
+		unreachable_box.max_x = MAX(unreachable_box.max_x, X + point.x());
+		unreachable_box.max_y = MAX(unreachable_box.max_y, Y + point.y());
+	    }
+	}
+	/* Grow by the tolerance of the halfplane/intersection tests so that
+	   boundary contacts are never pruned. */
+	unreachable_box.min_x -= EPSILON;
+	unreachable_box.min_y -= EPSILON;
+	unreachable_box.max_x += EPSILON;
+	unreachable_box.max_y += EPSILON;
+
+	unreachable_boxes.push_back(unreachable_box);
+    }
+}
+
+
 std::optional<std::pair<int, int> > check_PointsOutsidePolygons(const std::vector<Rational>                      &dec_values_X,
-								const std::vector<Rational>                      &dec_values_Y,	
+								const std::vector<Rational>                      &dec_values_Y,
 								const std::vector<Rational>                      &dec_values_T,
 								const std::vector<Slic3r::Polygon>               &polygons,
 								const std::vector<std::vector<Slic3r::Polygon> > &unreachable_polygons)
@@ -6617,12 +6689,19 @@ std::optional<std::pair<int, int> > check_PointsOutsidePolygons(const std::vecto
 
     if (!polygons.empty())
     {
+	std::vector<PlacedObjectBox> polygon_boxes, unreachable_boxes;
+	collect_PlacedObjectBoxes(dec_values_X, dec_values_Y, polygons, unreachable_polygons, polygon_boxes, unreachable_boxes);
+
 	for (unsigned int i = 0; i < polygons.size() - 1; ++i)
 	{
 	    for (unsigned int j = i + 1; j < polygons.size(); ++j)
 	    {
 		if (dec_values_T[i] > dec_values_T[j])
 		{
+		    if (!polygon_boxes[i].overlaps(unreachable_boxes[j]))
+		    {
+			continue;
+		    }
 		    for (unsigned int p1 = 0; p1 < polygons[i].points.size(); ++p1)
 		    {
 			const Point &point1 = polygons[i].points[p1];
@@ -6686,6 +6765,10 @@ std::optional<std::pair<int, int> > check_PointsOutsidePolygons(const std::vecto
 		}
 		else if (dec_values_T[i] < dec_values_T[j])
 		{
+		    if (!polygon_boxes[j].overlaps(unreachable_boxes[i]))
+		    {
+			continue;
+		    }
 		    for (unsigned int p2 = 0; p2 < polygons[j].points.size(); ++p2)
 		    {
 			const Point &point2 = polygons[j].points[p2];
@@ -6777,14 +6860,21 @@ std::optional<std::pair<int, int> > check_PolygonLineIntersections(const std::ve
 {
     if (!polygons.empty())
     {
+	std::vector<PlacedObjectBox> polygon_boxes, unreachable_boxes;
+	collect_PlacedObjectBoxes(dec_values_X, dec_values_Y, polygons, unreachable_polygons, polygon_boxes, unreachable_boxes);
+
 	for (unsigned int i = 0; i < polygons.size() - 1; ++i)
 	{
 	    for (unsigned int j = i + 1; j < polygons.size(); ++j)
 	    {
 		if (dec_values_T[i] > dec_values_T[j])
 		{
+		    if (!polygon_boxes[i].overlaps(unreachable_boxes[j]))
+		    {
+			continue;
+		    }
 		    for (unsigned int p1 = 0; p1 < polygons[i].points.size(); ++p1)
-		    {		
+		    {
 			const Point &point1 = polygons[i].points[p1];
 			const Point &next_point1 = polygons[i].points[(p1 + 1) % polygons[i].points.size()];
 
@@ -6849,6 +6939,10 @@ std::optional<std::pair<int, int> > check_PolygonLineIntersections(const std::ve
 		{
 		    if (dec_values_T[i] < dec_values_T[j])
 		    {
+			if (!polygon_boxes[j].overlaps(unreachable_boxes[i]))
+			{
+			    continue;
+			}
 			for (unsigned int poly1 = 0; poly1 < unreachable_polygons[i].size(); ++poly1)
 			{
 			    for (unsigned int p1 = 0; p1 < unreachable_polygons[i][poly1].points.size(); ++p1)
@@ -15,6 +15,8 @@
 #include <type_traits>
 #include <vector>
 
+#include <oneapi/tbb/parallel_invoke.h>
+
 #include <Eigen/Geometry>
 
 #include "BoundingBox.hpp"
@@ -123,6 +125,9 @@ public:
 	}
 
 private:
+	// Subtrees smaller than this are built serially, see build_recursive().
+	static constexpr const size_t parallel_build_min_size = 16384;
+
 	// Build a balanced tree by splitting the input sequence by an axis aligned plane at a dimension.
 	template<typename SourceNode>
 	void build_recursive(std::vector<SourceNode> &input, size_t node, const size_t left, const size_t right)
@@ -149,8 +154,17 @@ private:
 		// Insert an inner node into the tree. Inner node does not reference any input entity (triangle, line segment etc).
 		m_nodes[node].idx  = inner;
 		m_nodes[node].bbox = bbox;
-        build_recursive(input, node * 2 + 1, left, center);
-		build_recursive(input, node * 2 + 2, center + 1, right);
+		// The two children cover disjoint ranges of the input and disjoint subtrees of m_nodes,
+		// thus they may be built in parallel. Small subtrees are built serially to keep the
+		// task overhead negligible.
+		if (right - left > parallel_build_min_size) {
+			tbb::parallel_invoke(
+				[this, &input, node, left, center]  { build_recursive(input, node * 2 + 1, left, center); },
+				[this, &input, node, center, right] { build_recursive(input, node * 2 + 2, center + 1, right); });
+		} else {
+			build_recursive(input, node * 2 + 1, left, center);
+			build_recursive(input, node * 2 + 2, center + 1, right);
+		}
 	}
 
 	// Partition the input m_nodes <left, right> at "k" and "dimension" using the QuickSelect method:
@@ -356,15 +356,30 @@ public:
     int outside(const Vec<2, Scalar> &point) const { return point_outside_closed_contours(lines, tree, point); }
 
     // negative sign means inside
+    // search_radius_hint may be set to a known upper bound of the (unsigned) distance, for example the
+    // distance at a nearby sample point plus the distance between the samples. It prunes the tree
+    // traversal considerably when querying a dense sequence of coherent points. An invalid hint only
+    // costs an extra unbounded query, the result is always exact.
     template<bool SIGNED_DISTANCE>
-    std::tuple<Floating, size_t, Vec<2, Floating>> distance_from_lines_extra(const Vec<2, Scalar> &point) const
+    std::tuple<Floating, size_t, Vec<2, Floating>> distance_from_lines_extra(const Vec<2, Scalar> &point,
+        Floating search_radius_hint = std::numeric_limits<Floating>::infinity()) const
     {
         size_t           nearest_line_index_out = size_t(-1);
         Vec<2, Floating> nearest_point_out      = Vec<2, Floating>::Zero();
         Vec<2, Floating> p                      = point.template cast<Floating>();
-        auto distance = AABBTreeLines::squared_distance_to_indexed_lines(lines, tree, p, nearest_line_index_out, nearest_point_out);
+        Floating         max_sqr_dist           = std::numeric_limits<Floating>::infinity();
+        if (std::isfinite(search_radius_hint)) {
+            // Slightly inflate the bound, so that the nearest line is not missed when the true
+            // distance matches the bound exactly.
+            Floating bound = search_radius_hint * Floating(1. + 1e-4) + Floating(EPSILON);
+            max_sqr_dist   = bound * bound;
+        }
+        auto distance = AABBTreeLines::squared_distance_to_indexed_lines(lines, tree, p, nearest_line_index_out, nearest_point_out, max_sqr_dist);
+        if (nearest_line_index_out == size_t(-1) && std::isfinite(search_radius_hint))
+            // The hint was not a valid upper bound, repeat without it.
+            distance = AABBTreeLines::squared_distance_to_indexed_lines(lines, tree, p, nearest_line_index_out, nearest_point_out);
 
-        if (distance < 0) {
+        if (distance < 0 || nearest_line_index_out == size_t(-1)) {
             return {std::numeric_limits<Floating>::infinity(), nearest_line_index_out, nearest_point_out};
         }
         distance = sqrt(distance);
@@ -9,6 +9,8 @@
 #include <libslic3r/ClipperUtils.hpp>
 #include <libslic3r/Utils.hpp>
 #include <clipper/clipper_z.hpp>
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <numeric>
 #include <cmath>
 #include <iterator>
@@ -421,24 +423,41 @@ static Polygons propagate_wave_from_boundary(
 // Resulting regions are sorted by boundary id and source id.
 std::vector<RegionExpansion> propagate_waves(const WaveSeeds &seeds, const ExPolygons &boundary, const RegionExpansionParameters &params)
 {
-    std::vector<RegionExpansion> out;
-    ClipperLib::Paths            paths;
-    ClipperLib::ClipperOffset co;
-    co.ArcTolerance       = params.arc_tolerance;
-    co.ShortestEdgeLength = params.shortest_edge_length;
+    // Split the seeds into groups of the same boundary and source contour. Each group propagates
+    // an independent wavefront inside its own boundary, thus the groups may run in parallel,
+    // cutting down the long chains of Clipper offset & clip calls on layers with many anchors.
+    std::vector<std::pair<WaveSeeds::const_iterator, WaveSeeds::const_iterator>> seed_groups;
     for (auto it_seed = seeds.begin(); it_seed != seeds.end();) {
         auto it = it_seed;
-        paths.clear();
-        for (; it != seeds.end() && it->boundary == it_seed->boundary && it->src == it_seed->src; ++ it)
-            paths.emplace_back(it->path);
-        // Propagate the wavefront while clipping it with the trimmed boundary.
-        // Collect the expanded polygons, merge them with the source polygons.
-        RegionExpansion re;
-        for (Polygon &polygon : propagate_wave_from_boundary(co, paths, boundary[it_seed->boundary], params.initial_step, params.other_step, params.num_other_steps, params.max_inflation))
-            out.push_back({ std::move(polygon), it_seed->src, it_seed->boundary });
+        for (; it != seeds.end() && it->boundary == it_seed->boundary && it->src == it_seed->src; ++ it) ;
+        seed_groups.emplace_back(it_seed, it);
         it_seed = it;
     }
 
+    std::vector<std::vector<RegionExpansion>> out_per_group(seed_groups.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, seed_groups.size()),
+        [&seed_groups, &boundary, &params, &out_per_group](const tbb::blocked_range<size_t> &range) {
+        ClipperLib::Paths         paths;
+        ClipperLib::ClipperOffset co;
+        co.ArcTolerance       = params.arc_tolerance;
+        co.ShortestEdgeLength = params.shortest_edge_length;
+        for (size_t group_idx = range.begin(); group_idx < range.end(); ++ group_idx) {
+            const auto [it_seed, it_end] = seed_groups[group_idx];
+            paths.clear();
+            for (auto it = it_seed; it != it_end; ++ it)
+                paths.emplace_back(it->path);
+            // Propagate the wavefront while clipping it with the trimmed boundary.
+            // Collect the expanded polygons, merge them with the source polygons.
+            for (Polygon &polygon : propagate_wave_from_boundary(co, paths, boundary[it_seed->boundary], params.initial_step, params.other_step, params.num_other_steps, params.max_inflation))
+                out_per_group[group_idx].push_back({ std::move(polygon), it_seed->src, it_seed->boundary });
+        }
+    });
+
+    // Merging in the group order keeps the result sorted by boundary id and source id.
+    std::vector<RegionExpansion> out;
+    for (std::vector<RegionExpansion> &group_out : out_per_group)
+        append(out, std::move(group_out));
+
     return out;
 }
 
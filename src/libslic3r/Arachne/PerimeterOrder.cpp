@@ -46,29 +46,28 @@ static PerimeterExtrusions get_sorted_perimeter_extrusions_by_area(const Perimet
 // Functions fill adjacent_perimeter_extrusions field for every PerimeterExtrusion by pointers to PerimeterExtrusions that contain or are inside this PerimeterExtrusion.
 static void construct_perimeter_extrusions_adjacency_graph(PerimeterExtrusions &sorted_perimeter_extrusions) {
     // Construct a graph (defined using adjacent_perimeter_extrusions field) where two PerimeterExtrusion are adjacent when one is inside the other.
-    std::vector<bool> root_candidates(sorted_perimeter_extrusions.size(), false);
+    // Because the extrusions are sorted by area, each closed extrusion absorbs exactly the current roots
+    // (extrusions not contained in any smaller extrusion processed so far) that it contains. Keep an
+    // explicit list of the current roots instead of rescanning all extrusions with a flag per iteration.
+    std::vector<size_t> root_candidates;
+    root_candidates.reserve(sorted_perimeter_extrusions.size());
     for (PerimeterExtrusion &perimeter_extrusion : sorted_perimeter_extrusions) {
         const size_t perimeter_extrusion_idx = &perimeter_extrusion - sorted_perimeter_extrusions.data();
 
-        if (!perimeter_extrusion.is_closed()) {
-            root_candidates[perimeter_extrusion_idx] = true;
-            continue;
-        }
-
-        for (PerimeterExtrusion &root_candidate : sorted_perimeter_extrusions) {
-            const size_t root_candidate_idx = &root_candidate - sorted_perimeter_extrusions.data();
-
-            if (!root_candidates[root_candidate_idx])
-                continue;
-
-            if (perimeter_extrusion.bbox.contains(root_candidate.bbox) && perimeter_extrusion.polygon.contains(root_candidate.extrusion.junctions.front().p)) {
-                perimeter_extrusion.adjacent_perimeter_extrusions.emplace_back(&root_candidate);
-                root_candidate.adjacent_perimeter_extrusions.emplace_back(&perimeter_extrusion);
-                root_candidates[root_candidate_idx] = false;
+        if (perimeter_extrusion.is_closed()) {
+            size_t roots_kept = 0;
+            for (const size_t root_candidate_idx : root_candidates) {
+                PerimeterExtrusion &root_candidate = sorted_perimeter_extrusions[root_candidate_idx];
+                if (perimeter_extrusion.bbox.contains(root_candidate.bbox) && perimeter_extrusion.polygon.contains(root_candidate.extrusion.junctions.front().p)) {
+                    perimeter_extrusion.adjacent_perimeter_extrusions.emplace_back(&root_candidate);
+                    root_candidate.adjacent_perimeter_extrusions.emplace_back(&perimeter_extrusion);
+                } else
+                    root_candidates[roots_kept ++] = root_candidate_idx;
             }
+            root_candidates.erase(root_candidates.begin() + roots_kept, root_candidates.end());
         }
 
-        root_candidates[perimeter_extrusion_idx] = true;
+        root_candidates.emplace_back(perimeter_extrusion_idx);
     }
 }
 
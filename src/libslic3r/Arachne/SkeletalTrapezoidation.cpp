@@ -332,13 +332,15 @@ Points SkeletalTrapezoidation::discretize(const VD::edge_type& vd_edge, const st
 SkeletalTrapezoidation::SkeletalTrapezoidation(const Polygons& polys, const BeadingStrategy& beading_strategy,
                                                double transitioning_angle, coord_t discretization_step_size,
                                                coord_t transition_filter_dist, coord_t allowed_filter_deviation,
-                                               coord_t beading_propagation_transition_dist
+                                               coord_t beading_propagation_transition_dist,
+                                               std::function<void()> throw_on_cancel
     ): transitioning_angle(transitioning_angle),
     discretization_step_size(discretization_step_size),
     transition_filter_dist(transition_filter_dist),
     allowed_filter_deviation(allowed_filter_deviation),
     beading_propagation_transition_dist(beading_propagation_transition_dist),
-    beading_strategy(beading_strategy)
+    beading_strategy(beading_strategy),
+    throw_on_cancel(std::move(throw_on_cancel))
 {
     constructFromPolygons(polys);
 }
@@ -376,6 +378,11 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 
     VD voronoi_diagram;
     voronoi_diagram.construct_voronoi(segments.cbegin(), segments.cend());
+    throw_on_cancel();
+
+    // Pre-size the Voronoi to half-edge maps, the number of entries is known up front.
+    vd_edge_to_he_edge.reserve(voronoi_diagram.num_edges());
+    vd_node_to_he_node.reserve(voronoi_diagram.num_vertices());
 
 #ifdef ARACHNE_DEBUG_VORONOI
     {
@@ -385,7 +392,12 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 #endif
 
     assert(this->graph.edges.empty() && this->graph.nodes.empty() && this->vd_edge_to_he_edge.empty() && this->vd_node_to_he_node.empty());
+    // The cell transfer below may take seconds on huge layers, check for cancellation once in a while.
+    constexpr size_t check_cancel_period = 1024;
+    size_t cell_idx = 0;
     for (const VD::cell_type &cell : voronoi_diagram.cells()) {
+        if (++ cell_idx % check_cancel_period == 0)
+            throw_on_cancel();
         if (!cell.incident_edge())
             continue; // There is no spoon
 
@@ -6,6 +6,7 @@
 
 #include <boost/polygon/voronoi.hpp>
 #include <ankerl/unordered_dense.h>
+#include <functional>
 #include <memory> // smart pointers
 #include <utility> // pair
 #include <list>
@@ -82,6 +83,13 @@ class SkeletalTrapezoidation
      */
     const BeadingStrategy& beading_strategy;
 
+    /*!
+     * Cooperative cancellation check, called periodically while transferring
+     * the Voronoi diagram into the half-edge graph. Expected to throw when the
+     * ongoing slicing operation was canceled.
+     */
+    std::function<void()> throw_on_cancel;
+
 public:
     using Segment  = PolygonsSegmentIndex;
     using NodeSet  = ankerl::unordered_dense::set<node_t*>;
@@ -102,6 +110,8 @@ public:
      * \param beading_propagation_transition_dist When there are different
      * beadings propagated from below and from above, use this transitioning
      * distance.
+     * \param throw_on_cancel Cooperative cancellation callback, checked
+     * periodically during the graph construction.
      */
     SkeletalTrapezoidation(const Polygons& polys,
                            const BeadingStrategy& beading_strategy,
@@ -109,7 +119,8 @@ public:
     , coord_t discretization_step_size
     , coord_t transition_filter_dist
     , coord_t allowed_filter_deviation
-    , coord_t beading_propagation_transition_dist);
+    , coord_t beading_propagation_transition_dist
+    , std::function<void()> throw_on_cancel = [](){});
 
     /*!
      * A skeletal graph through the polygons that we need to fill with beads.
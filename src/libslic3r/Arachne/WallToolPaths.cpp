@@ -328,18 +328,13 @@ void removeDegenerateVerts(Polygons &thiss)
 
 void removeSmallAreas(Polygons &thiss, const double min_area_size, const bool remove_holes)
 {
-    auto to_path = [](const Polygon &poly) -> ClipperLib::Path {
-        ClipperLib::Path out;
-        for (const Point &pt : poly.points)
-            out.emplace_back(ClipperLib::cInt(pt.x()), ClipperLib::cInt(pt.y()));
-        return out;
-    };
-
+    // Polygon::points is binary compatible with ClipperLib::Path (Slic3r::Point with the same
+    // allocator), thus the contours are handed to ClipperLib directly without a conversion copy.
     auto new_end = thiss.end();
     if (remove_holes) {
         for (auto it = thiss.begin(); it < new_end;) {
             // All polygons smaller than target are removed by replacing them with a polygon from the back of the vector.
-            if (fabs(ClipperLib::Area(to_path(*it))) < min_area_size) {
+            if (fabs(ClipperLib::Area(it->points)) < min_area_size) {
                 --new_end;
                 *it = std::move(*new_end);
                 continue; // Don't increment the iterator such that the polygon just swapped in is checked next.
@@ -350,7 +345,7 @@ void removeSmallAreas(Polygons &thiss, const double min_area_size, const bool re
         // For each polygon, computes the signed area, move small outlines at the end of the vector and keep pointer on small holes
         Polygons small_holes;
         for (auto it = thiss.begin(); it < new_end;) {
-            if (double area = ClipperLib::Area(to_path(*it)); fabs(area) < min_area_size) {
+            if (double area = ClipperLib::Area(it->points); fabs(area) < min_area_size) {
                 if (area >= 0) {
                     --new_end;
                     if (it < new_end) {
@@ -371,7 +366,7 @@ void removeSmallAreas(Polygons &thiss, const double min_area_size, const bool re
         const auto removed_outlines_start = new_end;
         for (auto hole_it = small_holes.rbegin(); hole_it < small_holes.rend(); hole_it++)
             for (auto outline_it = removed_outlines_start; outline_it < thiss.end(); outline_it++)
-                if (Polygon(*outline_it).contains(*hole_it->begin())) {
+                if (outline_it->contains(*hole_it->begin())) {
                     new_end--;
                     *hole_it = std::move(*new_end);
                     break;
@@ -483,6 +478,7 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
     // Clipper union also fixed an issue in Arachne that in post-processing Voronoi diagram, some edges
     // didn't have twin edges. (a non-planar Voronoi diagram probably caused this).
     prepared_outline = union_(prepared_outline);
+    throw_on_cancel();
 
     if (area(prepared_outline) <= 0) {
         assert(toolpaths.empty());
@@ -522,9 +518,14 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
         discretization_step_size,
         transition_filter_dist,
         allowed_filter_deviation,
-        wall_transition_length
+        wall_transition_length,
+        throw_on_cancel
     );
+    // The skeletal trapezoidation above and the toolpath generation below dominate the Arachne wall
+    // computation, check for cancellation between them.
+    throw_on_cancel();
     wall_maker.generateToolpaths(toolpaths);
+    throw_on_cancel();
 
     stitchToolPaths(toolpaths, this->bead_width_x);
 
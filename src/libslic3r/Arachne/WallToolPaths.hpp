@@ -6,6 +6,7 @@
 
 #include <ankerl/unordered_dense.h>
 #include <stddef.h>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -85,6 +86,11 @@ public:
 
     using ExtrusionLineSet = ankerl::unordered_dense::set<std::pair<const ExtrusionLine *, const ExtrusionLine *>, boost::hash<std::pair<const ExtrusionLine *, const ExtrusionLine *>>>;
 
+    /*!
+     * Sets the callback invoked between the expensive phases of \p generate(), allowing a canceled slicing job to abort promptly.
+     */
+    void set_throw_on_cancel(const std::function<void()> &callback) { throw_on_cancel = callback; }
+
 protected:
     /*!
      * Stitch the polylines together and form closed polygons.
@@ -123,6 +129,7 @@ private:
     bool toolpaths_generated; //<! Are the toolpaths generated
     std::vector<VariableWidthLines> toolpaths; //<! The generated toolpaths
     Polygons inner_contour;  //<! The inner contour of the generated toolpaths
+    std::function<void()> throw_on_cancel { [](){} }; //<! Cooperative cancellation check called between the generation phases
     const PrintObjectConfig &print_object_config;
 };
 
@@ -8,7 +8,7 @@
 #include <list>
 #include <cassert>
 
-
+#include <oneapi/tbb/scalable_allocator.h>
 
 #include "HalfEdge.hpp"
 #include "HalfEdgeNode.hpp"
@@ -21,8 +21,12 @@ class HalfEdgeGraph
 public:
     using edge_t = derived_edge_t;
     using node_t = derived_node_t;
-    using Edges = std::list<edge_t>;
-    using Nodes = std::list<node_t>;
+    // The graph relies on the pointer stability of std::list (edges / nodes reference each other by
+    // raw pointers and are collapsed in the middle of the lists), however the graphs are built from
+    // one list node allocation per Voronoi edge / vertex. Back the lists by the thread local pools
+    // of the TBB scalable allocator to take that traffic off the global heap.
+    using Edges = std::list<edge_t, tbb::scalable_allocator<edge_t>>;
+    using Nodes = std::list<node_t, tbb::scalable_allocator<node_t>>;
     Edges edges;
     Nodes nodes;
 };
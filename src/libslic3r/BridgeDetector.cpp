@@ -6,6 +6,8 @@
 ///|/
 #include "BridgeDetector.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <algorithm>
 #include <cstddef>
 
@@ -112,8 +114,13 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         bridge in several directions and then sum the length of lines having both
         endpoints within anchors */
         
-    bool have_coverage = false;
-    for (size_t i_angle = 0; i_angle < candidates.size(); ++ i_angle)
+    // Testing a direction is independent of the others and the Clipper intersections
+    // dominate, thus run the sweep in parallel. The work nests under the per-layer
+    // parallelism of PrintObject::process_external_surfaces() and pays off on layers
+    // with large bridging regions, where a single surface owns the whole sweep.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, candidates.size()),
+        [this, &candidates, &clip_area](const tbb::blocked_range<size_t> &range) {
+    for (size_t i_angle = range.begin(); i_angle < range.end(); ++ i_angle)
     {
         const double angle = candidates[i_angle].angle;
 
@@ -151,7 +158,6 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         if (total_length == 0.)
             continue;
 
-        have_coverage = true;
         // Sum length of bridged lines.
         candidates[i_angle].coverage = total_length;
         /*  The following produces more correct results in some cases and more broken in others.
@@ -160,9 +166,10 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         // max length of bridged lines
         candidates[i_angle].max_length = max_length;
     }
+    });
 
     // if no direction produced coverage, then there's no bridge direction
-    if (! have_coverage)
+    if (std::all_of(candidates.begin(), candidates.end(), [](const BridgeDirection &c) { return c.coverage == 0.; }))
         return false;
     
     // sort directions by coverage - most coverage first
@@ -81,10 +81,12 @@ static ExPolygons get_print_object_bottom_layer_expolygons(const PrintObject &pr
 // Returns ExPolygons of bottom layer for every print object in Print after elephant foot compensation.
 static std::vector<ExPolygons> get_print_bottom_layers_expolygons(const Print &print)
 {
-    std::vector<ExPolygons> bottom_layers_expolygons;
-    bottom_layers_expolygons.reserve(print.objects().size());
-    for (const PrintObject *object : print.objects())
-        bottom_layers_expolygons.emplace_back(get_print_object_bottom_layer_expolygons(*object));
+    std::vector<ExPolygons> bottom_layers_expolygons(print.objects().size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print.objects().size()),
+        [&print, &bottom_layers_expolygons](const tbb::blocked_range<size_t> &range) {
+            for (size_t print_object_idx = range.begin(); print_object_idx < range.end(); ++print_object_idx)
+                bottom_layers_expolygons[print_object_idx] = get_print_object_bottom_layer_expolygons(*print.objects()[print_object_idx]);
+        }); // end of parallel_for
 
     return bottom_layers_expolygons;
 }
@@ -185,41 +187,49 @@ static ExPolygons top_level_outer_brim_area(const Print                   &print
     for (const PrintObject *object : top_level_objects_with_brim)
         top_level_objects_idx.insert(object->id().id);
 
-    ExPolygons brim_area;
-    ExPolygons no_brim_area;
-    for(size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++print_object_idx) {
-        const PrintObject *object            = print.objects()[print_object_idx];
-        const BrimType     brim_type         = object->config().brim_type.value;
-        const float        brim_separation   = scale_(object->config().brim_separation.value);
-        const float        brim_width        = scale_(object->config().brim_width.value);
-        const bool         is_top_outer_brim = top_level_objects_idx.find(object->id().id) != top_level_objects_idx.end();
-
-        ExPolygons brim_area_object;
-        ExPolygons no_brim_area_object;
-        for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx]) {
-            if ((brim_type == BrimType::btOuterOnly || brim_type == BrimType::btOuterAndInner) && is_top_outer_brim)
-                append(brim_area_object, diff_ex(offset(ex_poly.contour, brim_width + brim_separation, ClipperLib::jtSquare), offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare)));
-
-            // After 7ff76d07684858fd937ef2f5d863f105a10f798e offset and shrink don't work with CW polygons (holes), so let's make it CCW.
-            Polygons ex_poly_holes_reversed = ex_poly.holes;
-            polygons_reverse(ex_poly_holes_reversed);
-            if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
-                append(no_brim_area_object, shrink_ex(ex_poly_holes_reversed, no_brim_offset, ClipperLib::jtSquare));
-
-            if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
-                append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
-
-            if (brim_type != BrimType::btNoBrim)
-                append(no_brim_area_object, offset_ex(ExPolygon(ex_poly.contour), brim_separation, ClipperLib::jtSquare));
-
-            no_brim_area_object.emplace_back(ex_poly.contour);
+    // Candidate brim and no-brim areas are produced for each object in parallel, the translation
+    // into instances and the final clipping of the brim by the no-brim areas is left to one merge below.
+    std::vector<ExPolygons> brim_area_objects(print.objects().size());
+    std::vector<ExPolygons> no_brim_area_objects(print.objects().size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print.objects().size()),
+        [&print, &top_level_objects_idx, &bottom_layers_expolygons, no_brim_offset, &brim_area_objects, &no_brim_area_objects](const tbb::blocked_range<size_t> &range) {
+        for (size_t print_object_idx = range.begin(); print_object_idx < range.end(); ++print_object_idx) {
+            const PrintObject *object            = print.objects()[print_object_idx];
+            const BrimType     brim_type         = object->config().brim_type.value;
+            const float        brim_separation   = scale_(object->config().brim_separation.value);
+            const float        brim_width        = scale_(object->config().brim_width.value);
+            const bool         is_top_outer_brim = top_level_objects_idx.find(object->id().id) != top_level_objects_idx.end();
+
+            ExPolygons &brim_area_object    = brim_area_objects[print_object_idx];
+            ExPolygons &no_brim_area_object = no_brim_area_objects[print_object_idx];
+            for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx]) {
+                if ((brim_type == BrimType::btOuterOnly || brim_type == BrimType::btOuterAndInner) && is_top_outer_brim)
+                    append(brim_area_object, diff_ex(offset(ex_poly.contour, brim_width + brim_separation, ClipperLib::jtSquare), offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare)));
+
+                // After 7ff76d07684858fd937ef2f5d863f105a10f798e offset and shrink don't work with CW polygons (holes), so let's make it CCW.
+                Polygons ex_poly_holes_reversed = ex_poly.holes;
+                polygons_reverse(ex_poly_holes_reversed);
+                if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
+                    append(no_brim_area_object, shrink_ex(ex_poly_holes_reversed, no_brim_offset, ClipperLib::jtSquare));
+
+                if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
+                    append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
+
+                if (brim_type != BrimType::btNoBrim)
+                    append(no_brim_area_object, offset_ex(ExPolygon(ex_poly.contour), brim_separation, ClipperLib::jtSquare));
+
+                no_brim_area_object.emplace_back(ex_poly.contour);
+            }
         }
+    }); // end of parallel_for
 
-        for (const PrintInstance &instance : object->instances()) {
-            append_and_translate(brim_area, brim_area_object, instance);
-            append_and_translate(no_brim_area, no_brim_area_object, instance);
+    ExPolygons brim_area;
+    ExPolygons no_brim_area;
+    for (size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++print_object_idx)
+        for (const PrintInstance &instance : print.objects()[print_object_idx]->instances()) {
+            append_and_translate(brim_area, brim_area_objects[print_object_idx], instance);
+            append_and_translate(no_brim_area, no_brim_area_objects[print_object_idx], instance);
         }
-    }
 
     return diff_ex(brim_area, no_brim_area);
 }
@@ -310,63 +320,85 @@ static std::vector<InnerBrimExPolygons> inner_brim_area(const Print
     ExPolygons              no_brim_area;
     Polygons                holes_reversed;
 
-    // polygon_idx must correspond to idx generated inside has_polygons_nothing_inside()
-    size_t polygon_idx = 0;
-    for(size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++print_object_idx) {
-        const PrintObject *object          = print.objects()[print_object_idx];
-        const BrimType     brim_type       = object->config().brim_type.value;
-        const float        brim_separation = scale_(object->config().brim_separation.value);
-        const float        brim_width      = scale_(object->config().brim_width.value);
-        const bool         top_outer_brim  = top_level_objects_idx.find(object->id().id) != top_level_objects_idx.end();
-
-        ExPolygons brim_area_innermost_object;
-        ExPolygons brim_area_object;
-        ExPolygons no_brim_area_object;
-        Polygons   holes_reversed_object;
-        for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx]) {
-            if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btOuterAndInner) {
-                if (top_outer_brim)
-                    no_brim_area_object.emplace_back(ex_poly);
-                else
-                    append(brim_area_object, diff_ex(offset(ex_poly.contour, brim_width + brim_separation, ClipperLib::jtSquare), offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare)));
-            }
+    // Starting index into has_nothing_inside for each object. The indices must correspond to
+    // the indices generated inside has_polygons_nothing_inside().
+    std::vector<size_t> first_polygon_idx(print.objects().size() + 1, size_t(0));
+    for (size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++print_object_idx) {
+        size_t cnt = 0;
+        for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx])
+            cnt += print.objects()[print_object_idx]->instances().size() * (1 + ex_poly.holes.size());
+        first_polygon_idx[print_object_idx + 1] = first_polygon_idx[print_object_idx] + cnt;
+    }
+    assert(first_polygon_idx.back() == has_nothing_inside.size());
+
+    // Candidate brim areas are produced for each object in parallel, the translation into
+    // instances and the final clipping by the no-brim areas is left to one merge below.
+    std::vector<ExPolygons> brim_area_objects(print.objects().size());
+    std::vector<ExPolygons> no_brim_area_objects(print.objects().size());
+    std::vector<Polygons>   holes_reversed_objects(print.objects().size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print.objects().size()),
+        [&print, &top_level_objects_idx, &bottom_layers_expolygons, no_brim_offset, &has_nothing_inside, &first_polygon_idx,
+         &brim_area_innermost, &brim_area_objects, &no_brim_area_objects, &holes_reversed_objects](const tbb::blocked_range<size_t> &range) {
+        for (size_t print_object_idx = range.begin(); print_object_idx < range.end(); ++print_object_idx) {
+            const PrintObject *object          = print.objects()[print_object_idx];
+            const BrimType     brim_type       = object->config().brim_type.value;
+            const float        brim_separation = scale_(object->config().brim_separation.value);
+            const float        brim_width      = scale_(object->config().brim_width.value);
+            const bool         top_outer_brim  = top_level_objects_idx.find(object->id().id) != top_level_objects_idx.end();
+
+            size_t     polygon_idx = first_polygon_idx[print_object_idx];
+            ExPolygons brim_area_innermost_object;
+            ExPolygons &brim_area_object    = brim_area_objects[print_object_idx];
+            ExPolygons &no_brim_area_object = no_brim_area_objects[print_object_idx];
+            Polygons   &holes_reversed_object = holes_reversed_objects[print_object_idx];
+            for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx]) {
+                if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btOuterAndInner) {
+                    if (top_outer_brim)
+                        no_brim_area_object.emplace_back(ex_poly);
+                    else
+                        append(brim_area_object, diff_ex(offset(ex_poly.contour, brim_width + brim_separation, ClipperLib::jtSquare), offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare)));
+                }
 
-            // After 7ff76d07684858fd937ef2f5d863f105a10f798e offset and shrink don't work with CW polygons (holes), so let's make it CCW.
-            Polygons ex_poly_holes_reversed = ex_poly.holes;
-            polygons_reverse(ex_poly_holes_reversed);
-            for ([[maybe_unused]] const PrintInstance &instance : object->instances()) {
-                ++polygon_idx; // Increase idx because of the contour of the ExPolygon.
-
-                if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btOuterAndInner)
-                    for(const Polygon &hole : ex_poly_holes_reversed) {
-                        size_t hole_idx = &hole - &ex_poly_holes_reversed.front();
-                        if (has_nothing_inside[polygon_idx + hole_idx])
-                            append(brim_area_innermost_object, shrink_ex({hole}, brim_separation, ClipperLib::jtSquare));
-                        else
-                            append(brim_area_object, diff_ex(shrink_ex({hole}, brim_separation, ClipperLib::jtSquare), shrink_ex({hole}, brim_width + brim_separation, ClipperLib::jtSquare)));
-                    }
+                // After 7ff76d07684858fd937ef2f5d863f105a10f798e offset and shrink don't work with CW polygons (holes), so let's make it CCW.
+                Polygons ex_poly_holes_reversed = ex_poly.holes;
+                polygons_reverse(ex_poly_holes_reversed);
+                for ([[maybe_unused]] const PrintInstance &instance : object->instances()) {
+                    ++polygon_idx; // Increase idx because of the contour of the ExPolygon.
+
+                    if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btOuterAndInner)
+                        for(const Polygon &hole : ex_poly_holes_reversed) {
+                            size_t hole_idx = &hole - &ex_poly_holes_reversed.front();
+                            if (has_nothing_inside[polygon_idx + hole_idx])
+                                append(brim_area_innermost_object, shrink_ex({hole}, brim_separation, ClipperLib::jtSquare));
+                            else
+                                append(brim_area_object, diff_ex(shrink_ex({hole}, brim_separation, ClipperLib::jtSquare), shrink_ex({hole}, brim_width + brim_separation, ClipperLib::jtSquare)));
+                        }
+
+                    polygon_idx += ex_poly.holes.size(); // Increase idx for every hole of the ExPolygon.
+                }
 
-                polygon_idx += ex_poly.holes.size(); // Increase idx for every hole of the ExPolygon.
-            }
+                if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
+                    append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
 
-            if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
-                append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
+                if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
+                    append(no_brim_area_object, diff_ex(ex_poly.contour, shrink_ex(ex_poly_holes_reversed, no_brim_offset, ClipperLib::jtSquare)));
 
-            if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
-                append(no_brim_area_object, diff_ex(ex_poly.contour, shrink_ex(ex_poly_holes_reversed, no_brim_offset, ClipperLib::jtSquare)));
+                append(holes_reversed_object, ex_poly_holes_reversed);
+            }
+            append(no_brim_area_object, offset_ex(bottom_layers_expolygons[print_object_idx], brim_separation, ClipperLib::jtSquare));
+            assert(polygon_idx == first_polygon_idx[print_object_idx + 1]);
 
-            append(holes_reversed_object, ex_poly_holes_reversed);
+            for (const PrintInstance &instance : object->instances())
+                append_and_translate(brim_area_innermost[print_object_idx], brim_area_innermost_object, instance);
         }
-        append(no_brim_area_object, offset_ex(bottom_layers_expolygons[print_object_idx], brim_separation, ClipperLib::jtSquare));
+    }); // end of parallel_for
 
-        for (const PrintInstance &instance : object->instances()) {
-            append_and_translate(brim_area_innermost[print_object_idx], brim_area_innermost_object, instance);
-            append_and_translate(brim_area, brim_area_object, instance);
-            append_and_translate(no_brim_area, no_brim_area_object, instance);
-            append_and_translate(holes_reversed, holes_reversed_object, instance);
+    for (size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++print_object_idx)
+        for (const PrintInstance &instance : print.objects()[print_object_idx]->instances()) {
+            append_and_translate(brim_area, brim_area_objects[print_object_idx], instance);
+            append_and_translate(no_brim_area, no_brim_area_objects[print_object_idx], instance);
+            append_and_translate(holes_reversed, holes_reversed_objects[print_object_idx], instance);
         }
-    }
-    assert(polygon_idx == has_nothing_inside.size());
 
     ExPolygons brim_area_innermost_merged;
     // Append all innermost brim areas.
@@ -405,6 +405,13 @@ bool BuildVolume::all_paths_inside(const GCodeProcessorResult& paths, const Boun
         const Vec2f c = unscaled<float>(m_circle.center);
         const float r = unscaled<double>(m_circle.radius) + epsilon;
         const float r2 = sqr(r);
+        // Fast accept: if the furthest corner of the precalculated bounding box of all moves
+        // is inside the build volume, so are all the moves and the exact test below may be skipped.
+        // The box also covers moves skipped by move_valid(), which only errs towards the exact test.
+        const float dx = std::max(std::abs(float(paths_bbox.min.x()) - c.x()), std::abs(float(paths_bbox.max.x()) - c.x()));
+        const float dy = std::max(std::abs(float(paths_bbox.min.y()) - c.y()), std::abs(float(paths_bbox.max.y()) - c.y()));
+        if (sqr(dx) + sqr(dy) <= r2 && (m_max_print_height == 0.0 || paths_bbox.max.z() <= m_max_print_height + epsilon))
+            return true;
         return m_max_print_height == 0.0 ?
             std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, c, r2](const GCodeProcessorResult::MoveVertex &move)
                 { return ! move_valid(move) || (to_2d(move.position) - c).squaredNorm() <= r2; }) :
@@ -414,8 +421,16 @@ bool BuildVolume::all_paths_inside(const GCodeProcessorResult& paths, const Boun
     case Type::Convex:
     //FIXME doing test on convex hull until we learn to do test on non-convex polygons efficiently.
     case Type::Custom:
+        // Fast accept: all four corners of the bounding box of all moves inside the convex bed
+        // polygon imply the whole box is inside and the exact per move test may be skipped.
+        if (Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(paths_bbox.min)) &&
+            Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(paths_bbox.max)) &&
+            Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, Vec2d(paths_bbox.min.x(), paths_bbox.max.y())) &&
+            Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, Vec2d(paths_bbox.max.x(), paths_bbox.min.y())) &&
+            (m_max_print_height == 0.0 || paths_bbox.max.z() <= m_max_print_height + epsilon))
+            return true;
         return m_max_print_height == 0.0 ?
-            std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, this](const GCodeProcessorResult::MoveVertex &move) 
+            std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, this](const GCodeProcessorResult::MoveVertex &move)
                 { return ! move_valid(move) || Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(move.position).cast<double>()); }) :
             std::all_of(paths.moves.begin(), paths.moves.end(), [move_valid, this, z = m_max_print_height + epsilon](const GCodeProcessorResult::MoveVertex &move)
                 { return ! move_valid(move) || (Geometry::inside_convex_polygon(m_top_bottom_convex_hull_decomposition_bed, to_2d(move.position).cast<double>()) && move.position.z() <= z); });
@@ -5,6 +5,7 @@
 #ifndef PERFORMCSGMESHBOOLEANS_HPP
 #define PERFORMCSGMESHBOOLEANS_HPP
 
+#include <optional>
 #include <stack>
 #include <vector>
 
@@ -42,6 +43,16 @@ MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartT &csgpart)
     return ret;
 }
 
+// The verdict of check_csgmesh_booleans() for a single CSG part (no self intersections,
+// mesh bounds a volume) is expensive to compute and only depends on the part itself.
+// These methods can be overriden when a specific CSGPart type supports caching the verdict
+// between the checks, similarly to get_cgalmesh() above.
+template<class CSGPartT>
+std::optional<bool> get_cached_validity(const CSGPartT &) { return {}; }
+
+template<class CSGPartT>
+void set_cached_validity(const CSGPartT &, bool) {}
+
 namespace detail_cgal {
 
 using MeshBoolean::cgal::CGALMeshPtr;
@@ -150,7 +161,6 @@ It check_csgmesh_booleans(const Range<It> &csgrange, Visitor &&vfn)
         auto it = csgrange.begin();
         std::advance(it, i);
         auto &csgpart = *it;
-        auto m = get_cgalmesh(csgpart);
 
         // mesh can be nullptr if this is a stack push or pull
         if (!get_mesh(csgpart) && get_stack_operation(csgpart) != CSGStackOp::Continue) {
@@ -158,17 +168,34 @@ It check_csgmesh_booleans(const Range<It> &csgrange, Visitor &&vfn)
             return;
         }
 
-        try {
-            if (!m || MeshBoolean::cgal::empty(*m))
-                return;
+        // The checks may have been cached by a previous run over the same part.
+        const std::optional<bool> cached_valid = get_cached_validity(csgpart);
+        if (cached_valid.has_value() && !*cached_valid)
+            return;
 
-            if (MeshBoolean::cgal::does_self_intersect(*m))
-                return;
+        auto m = get_cgalmesh(csgpart);
 
-            if (!MeshBoolean::cgal::does_bound_a_volume(*m))
-                return;
+        if (!cached_valid.has_value()) {
+            try {
+                if (!m || MeshBoolean::cgal::empty(*m)) {
+                    set_cached_validity(csgpart, false);
+                    return;
+                }
+
+                if (MeshBoolean::cgal::does_self_intersect(*m)) {
+                    set_cached_validity(csgpart, false);
+                    return;
+                }
+
+                if (!MeshBoolean::cgal::does_bound_a_volume(*m)) {
+                    set_cached_validity(csgpart, false);
+                    return;
+                }
+            }
+            catch (...) { set_cached_validity(csgpart, false); return; }
+
+            set_cached_validity(csgpart, true);
         }
-        catch (...) { return; }
 
         cgalmeshes[i] = std::move(m);
     };
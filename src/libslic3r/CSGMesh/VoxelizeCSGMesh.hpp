@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <stack>
+#include <vector>
 
 #include "CSGMesh.hpp"
 #include "libslic3r/OpenVDBUtils.hpp"
@@ -79,30 +80,67 @@ VoxelGridPtr voxelize_csgmesh(const Range<It>      &csgrange,
         grids[csgidx] = get_voxelgrid(csgpart, params);
     }, execution::max_concurrency(ex_tbb));
 
-    size_t csgidx = 0;
     struct Frame { CSGType op = CSGType::Union; VoxelGridPtr grid; };
     std::stack opstack{std::vector<Frame>{}};
 
     opstack.push({CSGType::Union, mesh_to_grid({}, params)});
 
-    for (auto &csgpart : csgrange) {
+    // The operations only need to be known up front to recognize the runs of consecutive
+    // unions merged in parallel below, the part meshes are not needed anymore.
+    struct PartOp { CSGType op; CSGStackOp stackop; };
+    std::vector<PartOp> partops;
+    partops.reserve(csgrange.size());
+    for (auto &csgpart : csgrange)
+        partops.push_back({get_operation(csgpart), get_stack_operation(csgpart)});
+
+    for (size_t csgidx = 0; csgidx < partops.size(); ++csgidx) {
         if (params.statusfn() && params.statusfn()(-1))
             break;
 
-        auto &partgrid = grids[csgidx++];
-
-        auto op = get_operation(csgpart);
+        auto op = partops[csgidx].op;
 
-        if (get_stack_operation(csgpart) == CSGStackOp::Push) {
+        if (partops[csgidx].stackop == CSGStackOp::Push) {
             opstack.push({op, mesh_to_grid({}, params)});
             op = CSGType::Union;
         }
 
         Frame *top = &opstack.top();
 
-        perform_csg(get_operation(csgpart), top->grid, partgrid);
+        if (partops[csgidx].op == CSGType::Union && partops[csgidx].stackop == CSGStackOp::Continue) {
+            // Merge a run of consecutive unions with a parallel pairwise reduction. The union
+            // of the distance grids is associative, thus this yields the same grid as folding
+            // the parts into the accumulator one by one.
+            size_t run_end = csgidx + 1;
+            for (; run_end < partops.size() && partops[run_end].op == CSGType::Union &&
+                   partops[run_end].stackop == CSGStackOp::Continue; ++run_end);
+            if (run_end - csgidx > 2) {
+                std::vector<VoxelGridPtr*> run;
+                run.reserve(run_end - csgidx);
+                for (size_t i = csgidx; i < run_end; ++i)
+                    if (grids[i])
+                        run.emplace_back(&grids[i]);
+                while (run.size() > 1) {
+                    if (params.statusfn() && params.statusfn()(-1))
+                        break;
+                    execution::for_each(ex_tbb, size_t(0), run.size() / 2, [&run](size_t k) {
+                        perform_csg(CSGType::Union, *run[2 * k], *run[2 * k + 1]);
+                    });
+                    // Keep every merged pair and a possible unpaired last grid.
+                    size_t dst = 0;
+                    for (size_t k = 0; k < run.size(); k += 2)
+                        run[dst++] = run[k];
+                    run.resize(dst);
+                }
+                if (!run.empty())
+                    perform_csg(CSGType::Union, top->grid, *run.front());
+                csgidx = run_end - 1;
+                continue;
+            }
+        }
+
+        perform_csg(partops[csgidx].op, top->grid, grids[csgidx]);
 
-        if (get_stack_operation(csgpart) == CSGStackOp::Pop) {
+        if (partops[csgidx].stackop == CSGStackOp::Pop) {
             VoxelGridPtr popgrid = std::move(top->grid);
             auto popop = opstack.top().op;
             opstack.pop();
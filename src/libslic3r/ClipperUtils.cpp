@@ -11,7 +11,10 @@
 ///|/
 #include "ClipperUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <numeric>
 
 #include "ShortestPath.hpp"
 #include "libslic3r/BoundingBox.hpp"
@@ -21,6 +24,7 @@
 #include "libslic3r/libslic3r.h"
 
 #include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/parallel_reduce.h>
 
 // #define CLIPPER_UTILS_TIMING
@@ -29,11 +33,50 @@
     // time limit for one ClipperLib operation (union / diff / offset), in ms
     #define CLIPPER_UTILS_TIME_LIMIT_DEFAULT 50
     #include <boost/current_function.hpp>
+    #include <boost/log/trivial.hpp>
+    #include <string_view>
 
     #include "Timer.hpp"
 
-    #define CLIPPER_UTILS_TIME_LIMIT_SECONDS(limit) Timing::TimeLimitAlarm time_limit_alarm(uint64_t(limit) * 1000000000l, BOOST_CURRENT_FUNCTION)
-    #define CLIPPER_UTILS_TIME_LIMIT_MILLIS(limit) Timing::TimeLimitAlarm time_limit_alarm(uint64_t(limit) * 1000000l, BOOST_CURRENT_FUNCTION)
+    namespace {
+    // Per-thread throughput counters of the ClipperLib entry points, keyed by the calling function.
+    // Dumped into the log when the thread terminates, telling which boolean operation dominated
+    // a slow slicing job without rebuilding with a profiler attached.
+    struct ClipperUtilsStats
+    {
+        struct Entry {
+            uint64_t calls = 0;
+            uint64_t nanoseconds = 0;
+        };
+        std::map<std::string_view, Entry> entries;
+        ~ClipperUtilsStats() {
+            for (const auto &[name, entry] : entries)
+                BOOST_LOG_TRIVIAL(info) << "ClipperUtils stats: " << name << " calls: " << entry.calls
+                                        << " total milliseconds: " << entry.nanoseconds / 1000000;
+        }
+    };
+
+    // Scope guard combining the slow operation alarm with accumulation of per-thread counters.
+    class ClipperUtilsTimeGuard
+    {
+    public:
+        ClipperUtilsTimeGuard(uint64_t time_limit_nanoseconds, std::string_view name) :
+            m_alarm(time_limit_nanoseconds, name), m_name(name) { m_timer.start(); }
+        ~ClipperUtilsTimeGuard() {
+            static thread_local ClipperUtilsStats stats;
+            ClipperUtilsStats::Entry &entry = stats.entries[m_name];
+            ++ entry.calls;
+            entry.nanoseconds += m_timer.elapsed_nanoseconds();
+        }
+    private:
+        Slic3r::Timing::TimeLimitAlarm m_alarm;
+        Slic3r::Timing::Timer          m_timer;
+        std::string_view               m_name;
+    };
+    } // namespace
+
+    #define CLIPPER_UTILS_TIME_LIMIT_SECONDS(limit) ClipperUtilsTimeGuard time_limit_alarm(uint64_t(limit) * 1000000000l, BOOST_CURRENT_FUNCTION)
+    #define CLIPPER_UTILS_TIME_LIMIT_MILLIS(limit) ClipperUtilsTimeGuard time_limit_alarm(uint64_t(limit) * 1000000l, BOOST_CURRENT_FUNCTION)
 #else
     #define CLIPPER_UTILS_TIME_LIMIT_SECONDS(limit) do {} while(false)
     #define CLIPPER_UTILS_TIME_LIMIT_MILLIS(limit) do {} while(false)
@@ -208,6 +251,45 @@ namespace ClipperUtils {
     }
 }
 
+namespace ClipperUtils {
+    // Thread-local pool of ClipperLib::Paths buffers.
+    // ClipperLib stores its paths through tbb::scalable_allocator, which already removes the lock
+    // contention of the system allocator, however the hot ClipperUtils entry points (offset,
+    // union / diff / intersection with safety offset) still construct and destroy millions of
+    // short lived Paths vectors per print. The pool retains a bounded number of emptied buffers
+    // per thread, so the intermediate vectors keep their capacity across calls within a layer
+    // instead of round tripping through the allocator.
+    class PathsPool
+    {
+    public:
+        static ClipperLib::Paths acquire()
+        {
+            auto &pool = instance();
+            if (pool.m_buffers.empty())
+                return {};
+            ClipperLib::Paths out = std::move(pool.m_buffers.back());
+            pool.m_buffers.pop_back();
+            return out;
+        }
+
+        static void recycle(ClipperLib::Paths &&paths)
+        {
+            auto &pool = instance();
+            if (pool.m_buffers.size() < MaxRetained) {
+                paths.clear();
+                pool.m_buffers.emplace_back(std::move(paths));
+            }
+        }
+
+    private:
+        // Keep the retained memory bounded: the pool is a cache, not a leak.
+        static constexpr size_t MaxRetained = 32;
+        static PathsPool& instance() { static thread_local PathsPool pool; return pool; }
+
+        std::vector<ClipperLib::Paths> m_buffers;
+    };
+} // namespace ClipperUtils
+
 static ExPolygons PolyTreeToExPolygons(ClipperLib::PolyTree &&polytree)
 {
     struct Inner {
@@ -311,9 +393,9 @@ static ClipperLib::Paths raw_offset(PathsProvider &&paths, float offset, Clipper
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
     ClipperLib::ClipperOffset co;
-    ClipperLib::Paths out;
+    ClipperLib::Paths out = ClipperUtils::PathsPool::acquire();
     out.reserve(paths.size());
-    ClipperLib::Paths out_this;
+    ClipperLib::Paths out_this = ClipperUtils::PathsPool::acquire();
     if (joinType == jtRound)
         co.ArcTolerance = miterLimit;
     else
@@ -334,6 +416,7 @@ static ClipperLib::Paths raw_offset(PathsProvider &&paths, float offset, Clipper
         }
         append(out, std::move(out_this));
     }
+    ClipperUtils::PathsPool::recycle(std::move(out_this));
     return out;
 }
 
@@ -371,9 +454,13 @@ TResult clipper_do(
 {
     // Safety offset only allowed on intersection and difference.
     assert(do_safety_offset == ApplySafetyOffset::No || clipType != ClipperLib::ctUnion);
-    return do_safety_offset == ApplySafetyOffset::Yes ? 
-        clipper_do<TResult>(clipType, std::forward<TSubj>(subject), safety_offset(std::forward<TClip>(clip)), fillType) :
-        clipper_do<TResult>(clipType, std::forward<TSubj>(subject), std::forward<TClip>(clip), fillType);
+    if (do_safety_offset == ApplySafetyOffset::Yes) {
+        ClipperLib::Paths clip_offset = safety_offset(std::forward<TClip>(clip));
+        TResult out = clipper_do<TResult>(clipType, std::forward<TSubj>(subject), clip_offset, fillType);
+        ClipperUtils::PathsPool::recycle(std::move(clip_offset));
+        return out;
+    }
+    return clipper_do<TResult>(clipType, std::forward<TSubj>(subject), std::forward<TClip>(clip), fillType);
 }
 
 template<class TResult, class TSubj>
@@ -434,6 +521,7 @@ static TResult shrink_paths(PathsProvider &&paths, float offset, ClipperLib::Joi
         clipper.ReverseSolution(true);
         clipper.Execute(ClipperLib::ctUnion, out, ClipperLib::pftNegative, ClipperLib::pftNegative);
         remove_outermost_polygon(out);
+        ClipperUtils::PathsPool::recycle(std::move(raw));
     }
     return out;
 }
@@ -666,6 +754,34 @@ Slic3r::Polygons opening(const Slic3r::Surfaces &surfaces, const float delta1, c
     return to_polygons(expand_paths<ClipperLib::Paths>(shrink_paths<ClipperLib::Paths>(ClipperUtils::SurfacesProvider(surfaces), delta1, joinType, miterLimit), delta2, joinType, miterLimit));
 }
 
+// Morphological closing of multiple independent polygon sets in one parallel call.
+std::vector<Slic3r::ExPolygons> closing_ex(const std::vector<Slic3r::Polygons> &polygon_sets, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    assert(delta > 0);
+    std::vector<Slic3r::ExPolygons> out(polygon_sets.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, polygon_sets.size()),
+        [&polygon_sets, &out, delta, joinType, miterLimit](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                out[i] = closing_ex(polygon_sets[i], delta, joinType, miterLimit);
+        });
+    return out;
+}
+
+// Morphological opening of multiple independent expolygon sets in one parallel call.
+std::vector<Slic3r::ExPolygons> opening_ex(const std::vector<Slic3r::ExPolygons> &expolygon_sets, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    assert(delta > 0);
+    std::vector<Slic3r::ExPolygons> out(expolygon_sets.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, expolygon_sets.size()),
+        [&expolygon_sets, &out, delta, joinType, miterLimit](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                out[i] = opening_ex(expolygon_sets[i], delta, joinType, miterLimit);
+        });
+    return out;
+}
+
 // Fix of #117: A large fractal pyramid takes ages to slice
 // The Clipper library has difficulties processing overlapping polygons.
 // Namely, the function ClipperLib::JoinCommonEdges() has potentially a terrible time complexity if the output
@@ -1041,7 +1157,77 @@ Polygons union_parallel_reduce(const Polygons &subject)
         });
 }
 
-Polygons simplify_polygons(const Polygons &subject) {    
+ExPolygons union_ex_disjoint(const Slic3r::Polygons &subject)
+{
+    // For small inputs the clustering machinery does not pay off.
+    if (subject.size() < 8)
+        return union_ex(subject);
+
+    // 1) Cluster the contours by overlapping bounding boxes (union-find over a sweep along X).
+    std::vector<BoundingBox> bboxes;
+    bboxes.reserve(subject.size());
+    for (const Polygon &polygon : subject)
+        bboxes.emplace_back(get_extents(polygon));
+    std::vector<size_t> parent(subject.size());
+    std::iota(parent.begin(), parent.end(), size_t(0));
+    auto find_root = [&parent](size_t i) {
+        while (parent[i] != i) {
+            // Path splitting.
+            size_t next = parent[i];
+            parent[i] = parent[next];
+            i = next;
+        }
+        return i;
+    };
+    {
+        std::vector<size_t> order(subject.size());
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::sort(order.begin(), order.end(), [&bboxes](size_t l, size_t r) { return bboxes[l].min.x() < bboxes[r].min.x(); });
+        // Contours whose bounding box still spans the sweep line.
+        std::vector<size_t> active;
+        for (size_t i : order) {
+            const BoundingBox &bbox = bboxes[i];
+            size_t num_active = 0;
+            for (size_t j : active)
+                if (bboxes[j].max.x() >= bbox.min.x()) {
+                    active[num_active ++] = j;
+                    if (bboxes[j].max.y() >= bbox.min.y() && bboxes[j].min.y() <= bbox.max.y())
+                        parent[find_root(i)] = find_root(j);
+                }
+            active.resize(num_active);
+            active.emplace_back(i);
+        }
+    }
+
+    // 2) Collect the clusters, keeping the singletons apart.
+    std::map<size_t, Polygons> clusters;
+    for (size_t i = 0; i < subject.size(); ++ i)
+        clusters[find_root(i)].emplace_back(subject[i]);
+    ExPolygons out;
+    out.reserve(clusters.size());
+    std::vector<const Polygons*> overlapping_clusters;
+    for (auto &cluster : clusters)
+        if (cluster.second.size() == 1 && cluster.second.front().is_counter_clockwise())
+            // A lone counter-clockwise contour does not interact with anything, copy it as is.
+            // A lone clockwise contour (a hole without a contour) is left to Clipper to be culled.
+            out.emplace_back(std::move(cluster.second.front()));
+        else
+            overlapping_clusters.emplace_back(&cluster.second);
+
+    // 3) Union the clusters that actually touch, in parallel, and concatenate the results.
+    std::vector<ExPolygons> cluster_unions(overlapping_clusters.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, overlapping_clusters.size()),
+        [&overlapping_clusters, &cluster_unions](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                cluster_unions[i] = union_ex(*overlapping_clusters[i]);
+        });
+    for (ExPolygons &expolygons : cluster_unions)
+        append(out, std::move(expolygons));
+    return out;
+}
+
+Polygons simplify_polygons(const Polygons &subject) {
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
     ClipperLib::Paths output;
@@ -433,9 +433,15 @@ inline Slic3r::Polygons   opening(const Slic3r::Surfaces &surfaces, const float
     { return opening(surfaces, delta, delta, joinType, miterLimit); }
 inline Slic3r::ExPolygons opening_ex(const Slic3r::ExPolygons &polygons, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit) 
     { assert(delta > 0); return offset2_ex(polygons, - delta, delta, joinType, miterLimit); }
-inline Slic3r::ExPolygons opening_ex(const Slic3r::Surfaces &surfaces, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit) 
+inline Slic3r::ExPolygons opening_ex(const Slic3r::Surfaces &surfaces, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit)
     { assert(delta > 0); return offset2_ex(surfaces, - delta, delta, joinType, miterLimit); }
 
+// Batch variants of the morphological closing / opening above: every entry of the input vector
+// is an independent polygon set and all sets are processed in one parallel call. The sets are
+// not merged, the result of the i-th set is stored at the i-th slot of the output vector.
+std::vector<Slic3r::ExPolygons> closing_ex(const std::vector<Slic3r::Polygons> &polygon_sets, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+std::vector<Slic3r::ExPolygons> opening_ex(const std::vector<Slic3r::ExPolygons> &expolygon_sets, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+
 Slic3r::Lines _clipper_ln(ClipperLib::ClipType clipType, const Slic3r::Lines &subject, const Slic3r::Polygons &clip);
 
 // Safety offset is applied to the clipping polygons only.
@@ -546,6 +552,13 @@ Slic3r::Polygons union_pt_chained_outside_in(const Slic3r::Polygons &subject);
 // However, performing the union operation incrementally can be significantly faster in such cases.
 Slic3r::Polygons union_parallel_reduce(const Slic3r::Polygons &subject);
 
+// Fast path of union_ex() for inputs consisting mostly of disjoint islands (support layers,
+// merged slices of many objects): contours are clustered by overlapping bounding boxes,
+// only the clusters that actually touch are passed to Clipper (in parallel), single
+// counter-clockwise contours are emitted without paying for the union sweep at all.
+// Input contours shall be simple (non self-intersecting), like anywhere else in this file.
+Slic3r::ExPolygons union_ex_disjoint(const Slic3r::Polygons &subject);
+
 Slic3r::ExPolygons xor_ex(const Slic3r::ExPolygons &subject, const Slic3r::ExPolygon &clip, ApplySafetyOffset do_safety_offset = ApplySafetyOffset::No);
 Slic3r::ExPolygons xor_ex(const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, ApplySafetyOffset do_safety_offset = ApplySafetyOffset::No);
 
@@ -56,6 +56,9 @@
 #include <cassert>
 #include <cctype>
 #include <cfloat>
+#include <charconv>
+
+#include <fast_float.h>
 
 #include "libslic3r.h"
 #include "clonable_ptr.hpp"
@@ -137,6 +140,39 @@ namespace ConfigHelpers {
 		return boost::iequals(value, "enabled") || boost::iequals(value, "on");
 	}
 
+	// Fast replacement of the std::istringstream extraction formerly used by the numeric
+	// deserializers. Skips leading whitespace and ignores any trailing content (such as
+	// the optional trailing % of the percent options) just as the stream extraction did.
+	// Returns false and zeroes the value if no number could be parsed.
+	inline bool parse_double(const std::string &str, double &value)
+	{
+		const char *begin = str.data();
+		const char *end   = begin + str.size();
+		while (begin != end && (*begin == ' ' || *begin == '\t' || *begin == '\n' || *begin == '\r'))
+			++ begin;
+		if (auto result = fast_float::from_chars(begin, end, value); result.ec != std::errc()) {
+			value = 0.;
+			return false;
+		}
+		return true;
+	}
+
+	inline bool parse_int(const std::string &str, int &value)
+	{
+		const char *begin = str.data();
+		const char *end   = begin + str.size();
+		while (begin != end && (*begin == ' ' || *begin == '\t' || *begin == '\n' || *begin == '\r'))
+			++ begin;
+		// std::from_chars() does not accept an explicit plus sign, the stream extraction did.
+		if (begin != end && *begin == '+')
+			++ begin;
+		if (auto result = std::from_chars(begin, end, value); result.ec != std::errc()) {
+			value = 0;
+			return false;
+		}
+		return true;
+	}
+
 	enum class DeserializationSubstitution {
 		Disabled,
 		DefaultsToFalse,
@@ -733,18 +769,14 @@ public:
     bool deserialize(const std::string &str, bool append = false) override
     {
         UNUSED(append);
-        std::istringstream iss(str);
-
         if (str == "nil") {
             if (NULLABLE)
                 this->value = this->nil_value();
             else
                 throw ConfigurationError("Deserializing nil into a non-nullable object");
-        } else {
-            iss >> this->value;
+            return true;
         }
-
-        return !iss.fail();
+        return ConfigHelpers::parse_double(str, this->value);
     }
 
     ConfigOptionFloatTempl& operator=(const ConfigOption *opt)
@@ -829,9 +861,8 @@ public:
         		else
         			throw ConfigurationError("Deserializing nil into a non-nullable object");
         	} else {
-	            std::istringstream iss(item_str);
 	            double value;
-	            iss >> value;
+	            ConfigHelpers::parse_double(item_str, value);
 	            this->values.push_back(value);
 	        }
         }
@@ -923,18 +954,14 @@ public:
     bool deserialize(const std::string &str, bool append = false) override
     {
         UNUSED(append);
-        std::istringstream iss(str);
-
         if (str == "nil") {
             if (NULLABLE)
                 this->value = this->nil_value();
             else
                 throw ConfigurationError("Deserializing nil into a non-nullable object");
-        } else {
-            iss >> this->value;
+            return true;
         }
-
-        return !iss.fail();
+        return ConfigHelpers::parse_int(str, this->value);
     }
 
     ConfigOptionIntTempl& operator=(const ConfigOption *opt)
@@ -1013,9 +1040,8 @@ public:
         		else
                     throw ConfigurationError("Deserializing nil into a non-nullable object");
         	} else {
-	            std::istringstream iss(item_str);
 	            int value;
-	            iss >> value;
+	            ConfigHelpers::parse_int(item_str, value);
 	            this->values.push_back(value);
 	        }
         }
@@ -1138,9 +1164,7 @@ public:
     {
         UNUSED(append);
         // don't try to parse the trailing % since it's optional
-        std::istringstream iss(str);
-        iss >> this->value;
-        return !iss.fail();
+        return ConfigHelpers::parse_double(str, this->value);
     }
 
 private:
@@ -1252,9 +1276,7 @@ public:
     {
         UNUSED(append);
         this->percent = str.find_first_of("%") != std::string::npos;
-        std::istringstream iss(str);
-        iss >> this->value;
-        return !iss.fail();
+        return ConfigHelpers::parse_double(str, this->value);
     }
 
 private:
@@ -1330,9 +1352,8 @@ public:
                     throw ConfigurationError("Deserializing nil into a non-nullable object");
             } else {
                 bool percent = item_str.find_first_of("%") != std::string::npos;
-                std::istringstream iss(item_str);
                 double value;
-                iss >> value;
+                ConfigHelpers::parse_double(item_str, value);
                 this->values.push_back({ value, percent });
             }
         }
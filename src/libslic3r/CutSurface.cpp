@@ -905,21 +905,32 @@ void priv::set_skip_by_angle(std::vector<bool>          &skip_indicies,
     assert(max_angle < 90. && max_angle > 89.);
     assert(skip_indicies.size() == its.indices.size());
     float threshold = static_cast<float>(cos(max_angle / 180. * M_PI));
-    for (const stl_triangle_vertex_indices& face : its.indices) {
-        size_t index = &face - &its.indices.front();
-        if (skip_indicies[index]) continue;
-        Vec3f n = its_face_normal(its, face);
-        const Vec3f& v = its.vertices[face[0]];
-        const Vec3d vd = v.cast<double>();
-        // Improve: For Orthogonal Projection it is same for each vertex
-        Vec3d projectedd  = projection.project(vd);
-        Vec3f projected   = projectedd.cast<float>();
-        Vec3f project_dir = projected - v;
-        project_dir.normalize();
-        float cos_alpha = project_dir.dot(n);
-        if (cos_alpha > threshold) continue;
-        skip_indicies[index] = true;
-    }
+    // inspect all triangles, whether they are projected under too steep angle
+    // NOTE: skip_indicies is a packed vector<bool>, writing its bits from concurrent ranges
+    // would race on the shared words, thus flag the too steep triangles into a byte vector
+    // and merge serially afterwards. The parallel loop only reads skip_indicies.
+    std::vector<char> too_steep(its.indices.size(), 0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&its, &projection, &skip_indicies, &too_steep, threshold](const tbb::blocked_range<size_t> &range) {
+        for (size_t index = range.begin(); index < range.end(); ++index) {
+            if (skip_indicies[index]) continue;
+            const stl_triangle_vertex_indices &face = its.indices[index];
+            Vec3f n = its_face_normal(its, face);
+            const Vec3f& v = its.vertices[face[0]];
+            const Vec3d vd = v.cast<double>();
+            // Improve: For Orthogonal Projection it is same for each vertex
+            Vec3d projectedd  = projection.project(vd);
+            Vec3f projected   = projectedd.cast<float>();
+            Vec3f project_dir = projected - v;
+            project_dir.normalize();
+            float cos_alpha = project_dir.dot(n);
+            if (cos_alpha > threshold) continue;
+            too_steep[index] = 1;
+        }
+    }); // END parallel for
+    for (size_t index = 0; index < too_steep.size(); ++index)
+        if (too_steep[index])
+            skip_indicies[index] = true;
 }
 
 priv::CutMesh priv::to_cgal(const indexed_triangle_set &its,
@@ -9,6 +9,8 @@
 #include <set>
 #include <cfloat>
 
+#include <oneapi/tbb/parallel_for.h>
+
 #include "libslic3r.h"
 #include "ClipperUtils.hpp"
 #include "EdgeGrid.hpp"
@@ -692,8 +694,10 @@ void EdgeGrid::Grid::calculate_sdf()
 //	m_signed_distance_field.assign(nrows * ncols, FLT_MAX);
 	float search_radius = float(m_resolution<<1);
 	m_signed_distance_field.assign(nrows * ncols, search_radius);
-	// For each cell:
-	for (int r = 0; r < (int)m_rows; ++ r) {
+	// Distance seeding of one row of cells. The SDF, the unsigned vectors and the signs are all
+	// flat structure-of-arrays grids, thus the corner updates of a single row stream through
+	// contiguous memory.
+	auto seed_row = [this, nrows, ncols, &L, &signs](int r) {
 		for (int c = 0; c < (int)m_cols; ++ c) {
 			const Cell &cell = m_cells[r * m_cols + c];
 			// For each segment in the cell:
@@ -775,6 +779,22 @@ void EdgeGrid::Grid::calculate_sdf()
 				}
 			}
 		}
+	};
+
+	{
+		// Cells of row r update the corners of rows r-1 .. r+2, thus cells three or more rows
+		// apart never touch the same corner. Seed the rows in stripes of four, even stripes
+		// first, odd stripes second; stripes of the same parity never overlap and run in
+		// parallel without locking.
+		constexpr int stripe_height = 4;
+		const int     num_stripes   = (int(m_rows) + stripe_height - 1) / stripe_height;
+		for (int parity = 0; parity < 2; ++ parity)
+			tbb::parallel_for(0, (num_stripes + 1 - parity) / 2, [this, parity, &seed_row](int idx) {
+				const int stripe = 2 * idx + parity;
+				const int r_end  = std::min((stripe + 1) * stripe_height, int(m_rows));
+				for (int r = stripe * stripe_height; r < r_end; ++ r)
+					seed_row(r);
+			});
 	}
 
 #ifdef EDGE_GRID_DEBUG_OUTPUT
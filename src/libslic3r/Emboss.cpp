@@ -5,6 +5,8 @@
 #include <boost/nowide/convert.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/log/trivial.hpp>
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <numeric>
 #include <cstdlib>
 #include <algorithm>
@@ -101,8 +103,12 @@ bool is_valid(const FontFile &font, unsigned int index);
 fontinfo_opt load_font_info(const unsigned char *data, unsigned int index = 0);
 std::optional<Glyph> get_glyph(const stbtt_fontinfo &font_info, int unicode_letter, float flatness);
 
+// create glyph (without touching the cache)
+std::optional<Glyph> create_glyph(int unicode, const FontFile &font, const FontProp &font_prop,
+        const stbtt_fontinfo &font_info);
+
 // take glyph from cache
-const Glyph* get_glyph(int unicode, const FontFile &font, const FontProp &font_prop, 
+const Glyph* get_glyph(int unicode, const FontFile &font, const FontProp &font_prop,
         Glyphs &cache, fontinfo_opt &font_info_opt);
 
 // scale and convert float to int coordinate
@@ -776,40 +782,32 @@ std::optional<Glyph> get_glyph(const stbtt_fontinfo &font_info, int unicode_lett
     return glyph;
 }
 
-const Glyph* get_glyph(
-    int              unicode,
-    const FontFile & font,
-    const FontProp & font_prop,
-    Glyphs &         cache,
-    fontinfo_opt &font_info_opt)
+// Extract, flatten, heal and postprocess one glyph. Stateless with respect to
+// the glyph cache, so it may run for several glyphs in parallel over a shared
+// stbtt_fontinfo (stb_truetype only reads the font data).
+std::optional<Glyph> create_glyph(
+    int                   unicode,
+    const FontFile &      font,
+    const FontProp &      font_prop,
+    const stbtt_fontinfo &font_info)
 {
     // TODO: Use resolution by printer configuration, or add it into FontProp
     const float RESOLUTION = 0.0125f; // [in mm]
-    auto glyph_item = cache.find(unicode);
-    if (glyph_item != cache.end()) return &glyph_item->second;
-
     unsigned int font_index = font_prop.collection_number.value_or(0);
-    if (!is_valid(font, font_index)) return nullptr;
-
-    if (!font_info_opt.has_value()) {        
-        font_info_opt = load_font_info(font.data->data(), font_index);
-        // can load font info?
-        if (!font_info_opt.has_value()) return nullptr;
-    }
 
     float flatness = font.infos[font_index].unit_per_em / font_prop.size_in_mm * RESOLUTION;
 
     // Fix for very small flatness because it create huge amount of points from curve
     if (flatness < RESOLUTION) flatness = RESOLUTION;
 
-    std::optional<Glyph> glyph_opt = get_glyph(*font_info_opt, unicode, flatness);
+    std::optional<Glyph> glyph_opt = get_glyph(font_info, unicode, flatness);
 
     // IMPROVE: multiple loadig glyph without data
     // has definition inside of font?
-    if (!glyph_opt.has_value()) return nullptr;
+    if (!glyph_opt.has_value()) return glyph_opt;
 
     Glyph &glyph = *glyph_opt;
-    if (font_prop.char_gap.has_value()) 
+    if (font_prop.char_gap.has_value())
         glyph.advance_width += *font_prop.char_gap;
 
     // scale glyph size
@@ -833,7 +831,32 @@ const Glyph* get_glyph(
             }
         }
     }
-    auto [it, success] = cache.try_emplace(unicode, std::move(glyph));
+    return glyph_opt;
+}
+
+const Glyph* get_glyph(
+    int              unicode,
+    const FontFile & font,
+    const FontProp & font_prop,
+    Glyphs &         cache,
+    fontinfo_opt &font_info_opt)
+{
+    auto glyph_item = cache.find(unicode);
+    if (glyph_item != cache.end()) return &glyph_item->second;
+
+    unsigned int font_index = font_prop.collection_number.value_or(0);
+    if (!is_valid(font, font_index)) return nullptr;
+
+    if (!font_info_opt.has_value()) {
+        font_info_opt = load_font_info(font.data->data(), font_index);
+        // can load font info?
+        if (!font_info_opt.has_value()) return nullptr;
+    }
+
+    std::optional<Glyph> glyph_opt = create_glyph(unicode, font, font_prop, *font_info_opt);
+    if (!glyph_opt.has_value()) return nullptr;
+
+    auto [it, success] = cache.try_emplace(unicode, std::move(*glyph_opt));
     assert(success);
     return &it->second;
 }
@@ -1346,7 +1369,36 @@ ExPolygonsWithIds Emboss::text2vshapes(FontFileWithCache &font_with_cache, const
     unsigned counter = CANCEL_CHECK-1; // it is needed to validate using of cache
     Point cursor(0, 0);
 
-    fontinfo_opt font_info_cache;  
+    fontinfo_opt font_info_cache;
+
+    // Extract, flatten and heal the glyphs missing in the cache in parallel.
+    // Each glyph is created independently over a shared stbtt_fontinfo (stb_truetype
+    // only reads the font data), the layout loop below then hits the cache only.
+    std::vector<wchar_t> missing_letters;
+    missing_letters.reserve(text.size());
+    for (wchar_t letter : text)
+        if (letter != '\n' && letter != '\t' && letter != '\r' &&
+            cache->find(static_cast<int>(letter)) == cache->end())
+            missing_letters.push_back(letter);
+    sort_remove_duplicates(missing_letters);
+    if (missing_letters.size() > 1) {
+        if (!font_info_cache.has_value())
+            font_info_cache = load_font_info(font.data->data(), font_index);
+        if (font_info_cache.has_value()) {
+            std::vector<std::optional<Glyph>> glyphs(missing_letters.size());
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, missing_letters.size()),
+            [&missing_letters, &glyphs, &font, &font_prop, &font_info_cache](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++i)
+                    glyphs[i] = create_glyph(static_cast<int>(missing_letters[i]), font, font_prop, *font_info_cache);
+            });
+            for (size_t i = 0; i < missing_letters.size(); ++i)
+                if (glyphs[i].has_value())
+                    cache->try_emplace(static_cast<int>(missing_letters[i]), std::move(*glyphs[i]));
+        }
+        if (was_canceled())
+            return {};
+    }
+
     ExPolygonsWithIds result;
     result.reserve(text.size());
     for (wchar_t letter : text) {
@@ -192,31 +192,49 @@ void ExPolygon::simplify_p(double tolerance, Polygons* polygons) const
     polygons->insert(polygons->end(), pp.begin(), pp.end());
 }
 
-Polygons ExPolygon::simplify_p(double tolerance) const
+Polygons ExPolygon::simplify_p(double tolerance, bool *decimated) const
 {
     Polygons pp;
     pp.reserve(this->holes.size() + 1);
+    size_t num_removed = 0;
     // contour
     {
         Polygon p = this->contour;
         p.points.push_back(p.points.front());
         p.points = MultiPoint::douglas_peucker(p.points, tolerance);
         p.points.pop_back();
+        num_removed += this->contour.points.size() - p.points.size();
         pp.emplace_back(std::move(p));
     }
     // holes
-    for (Polygon p : this->holes) {
+    for (const Polygon &hole : this->holes) {
+        Polygon p = hole;
         p.points.push_back(p.points.front());
         p.points = MultiPoint::douglas_peucker(p.points, tolerance);
         p.points.pop_back();
+        num_removed += hole.points.size() - p.points.size();
         pp.emplace_back(std::move(p));
     }
+    if (decimated != nullptr)
+        *decimated = num_removed > 0;
+    if (num_removed == 0) {
+        // Douglas-Peucker only removes vertices. With none removed the contours are bit exact
+        // copies of the input, which is expected to be canonical already (CCW contour, CW holes,
+        // no self intersections), thus the Clipper re-canonicalization pass would be a no-op.
+        assert(this->is_valid());
+        return pp;
+    }
     return simplify_polygons(pp);
 }
 
 ExPolygons ExPolygon::simplify(double tolerance) const
 {
-    return union_ex(this->simplify_p(tolerance));
+    bool decimated;
+    Polygons pp = this->simplify_p(tolerance, &decimated);
+    if (! decimated)
+        // Bit exact copy of a canonical input, no need to regroup contours and holes.
+        return { *this };
+    return union_ex(pp);
 }
 
 void ExPolygon::simplify(double tolerance, ExPolygons* expolygons) const
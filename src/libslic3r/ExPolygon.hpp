@@ -92,7 +92,10 @@ public:
     bool overlaps(const ExPolygon &other) const;
 
     void simplify_p(double tolerance, Polygons* polygons) const;
-    Polygons simplify_p(double tolerance) const;
+    // Decimate the contours with Douglas-Peucker, then re-canonicalize with Clipper.
+    // The Clipper pass is skipped if the decimation removed no vertex, assuming *this is canonical.
+    // If decimated is provided, it is set to whether the decimation removed any vertex.
+    Polygons simplify_p(double tolerance, bool *decimated = nullptr) const;
     ExPolygons simplify(double tolerance) const;
     void simplify(double tolerance, ExPolygons* expolygons) const;
     void medial_axis(double min_width, double max_width, ThickPolylines* polylines) const;
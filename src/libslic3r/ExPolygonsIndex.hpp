@@ -40,7 +40,12 @@ struct ExPolygonsIndex
 /// </summary>
 class ExPolygonsIndices
 {
-    std::vector<std::vector<uint32_t>> m_offsets;
+    // offset of the first point of every polygon (contours and holes in their expolygon order),
+    // terminated by the total count of points
+    std::vector<uint32_t> m_offsets;
+    // index into m_offsets of the contour of every expolygon,
+    // terminated by the total count of polygons
+    std::vector<uint32_t> m_expolygon_offsets;
     // for check range of index
     uint32_t m_count; // count of points
 public:
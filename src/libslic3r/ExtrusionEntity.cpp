@@ -35,9 +35,16 @@ void ExtrusionPath::clip_end(double distance)
     this->polyline.clip_end(distance);
 }
 
-void ExtrusionPath::simplify(double tolerance)
+size_t ExtrusionPath::simplify(double tolerance)
 {
+    const size_t size_before = this->polyline.size();
     this->polyline.simplify(tolerance);
+    const size_t removed = size_before - this->polyline.size();
+    if (removed > 0)
+        // Return the capacity of the removed vertices: the extrusions produced here sit in RAM
+        // until the G-code export consumes them, on big prints across all layers at once.
+        this->polyline.points.shrink_to_fit();
+    return removed;
 }
 
 double ExtrusionPath::length() const
@@ -81,6 +88,14 @@ double ExtrusionMultiPath::length() const
     return len;
 }
 
+size_t ExtrusionMultiPath::simplify(double tolerance)
+{
+    size_t removed = 0;
+    for (ExtrusionPath &path : this->paths)
+        removed += path.simplify(tolerance);
+    return removed;
+}
+
 void ExtrusionMultiPath::polygons_covered_by_width(Polygons &out, const float scaled_epsilon) const
 {
     for (const ExtrusionPath &path : this->paths)
@@ -174,6 +189,16 @@ double ExtrusionLoop::length() const
     return len;
 }
 
+size_t ExtrusionLoop::simplify(double tolerance)
+{
+    // Douglas-Peucker keeps the end points of the individual paths,
+    // thus the loop remains closed.
+    size_t removed = 0;
+    for (ExtrusionPath &path : this->paths)
+        removed += path.simplify(tolerance);
+    return removed;
+}
+
 bool ExtrusionLoop::split_at_vertex(const Point &point, const double scaled_epsilon)
 {
     for (ExtrusionPaths::iterator path = this->paths.begin(); path != this->paths.end(); ++path)
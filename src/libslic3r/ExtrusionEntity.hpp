@@ -72,6 +72,11 @@ public:
     virtual Polylines as_polylines() const { Polylines dst; this->collect_polylines(dst); return dst; }
     virtual double length() const = 0;
     virtual double total_volume() const = 0;
+    // Decimate the contained polylines with the Douglas-Peucker algorithm.
+    // End points of the individual paths are always kept, thus connectivity of
+    // multi-paths, loops and collections is preserved.
+    // Returns the number of vertices removed.
+    virtual size_t simplify(double tolerance) = 0;
 };
 
 using ExtrusionEntitiesPtr = std::vector<ExtrusionEntity*>;
@@ -193,7 +198,7 @@ public:
     // Currently not used.
     void subtract_expolygons(const ExPolygons &collection, ExtrusionEntityCollection* retval) const;
     void clip_end(double distance);
-    void simplify(double tolerance);
+    size_t simplify(double tolerance) override;
     double length() const override;
    
     const ExtrusionAttributes&  attributes() const { return m_attributes; }
@@ -270,6 +275,7 @@ public:
     size_t size() const { return this->paths.size(); }
     bool empty() const { return this->paths.empty(); }
     double length() const override;
+    size_t simplify(double tolerance) override;
     ExtrusionRole role() const override { return this->paths.empty() ? ExtrusionRole::None : this->paths.front().role(); }
     // Produce a list of 2D polygons covered by the extruded paths, offsetted by the extrusion width.
     // Increase the offset by scaled_epsilon to achieve an overlap, so a union will produce no gaps.
@@ -327,6 +333,7 @@ public:
     const Point&    middle_point() const override { auto& path = this->paths[this->paths.size() / 2]; return path.polyline.points[path.polyline.size() / 2]; }
     Polygon         polygon() const;
     double          length() const override;
+    size_t          simplify(double tolerance) override;
     bool            split_at_vertex(const Point &point, const double scaled_epsilon = scaled<double>(0.001));
     void            split_at(const Point &point, bool prefer_non_overhang, const double scaled_epsilon = scaled<double>(0.001));
     struct ClosestPathPoint {
@@ -60,6 +60,7 @@ void ExtrusionEntityCollection::clear()
 ExtrusionEntityCollection::operator ExtrusionPaths() const
 {
     ExtrusionPaths paths;
+    paths.reserve(this->entities.size());
     for (const ExtrusionEntity *ptr : this->entities) {
         if (const ExtrusionPath *path = dynamic_cast<const ExtrusionPath*>(ptr))
             paths.push_back(*path);
@@ -139,6 +140,8 @@ ExtrusionEntityCollection ExtrusionEntityCollection::flatten(bool preserve_order
 		}
 	} flatten(preserve_ordering);
 
+	// Upper bound: with preserve_ordering the no_sort subtrees are appended as single entities.
+	flatten.out.entities.reserve(this->items_count());
 	flatten.recursive_do(*this);
     return flatten.out;
 }
@@ -76,6 +76,9 @@ public:
         for (const ExtrusionEntity *ee : entities) {
             ExtrusionRole er = ee->role();
             out = (out == ExtrusionRole::None || out == er) ? er : ExtrusionRole::Mixed;
+            if (out == ExtrusionRole::Mixed)
+                // Mixed is absorbing, no point in visiting the rest of the hierarchy.
+                break;
         }
         return out;
     }
@@ -158,7 +161,14 @@ public:
 
     double length() const override {
         throw Slic3r::RuntimeError("Calling length() on a ExtrusionEntityCollection");
-        return 0.;        
+        return 0.;
+    }
+
+    size_t simplify(double tolerance) override {
+        size_t removed = 0;
+        for (ExtrusionEntity *extrusion_entity : this->entities)
+            removed += extrusion_entity->simplify(tolerance);
+        return removed;
     }
 };
 
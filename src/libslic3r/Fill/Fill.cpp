@@ -7,6 +7,8 @@
 ///|/
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/scalable_allocator.h>
 #include <boost/container/vector.hpp>
 #include <memory>
@@ -494,126 +496,161 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
 
 	size_t first_object_layer_id = this->object()->get_layer(0)->id();
-    for (SurfaceFill &surface_fill : surface_fills) {
-        // Create the filler object.
-        std::unique_ptr<Fill> f = std::unique_ptr<Fill>(Fill::new_from_type(surface_fill.params.pattern));
-        f->set_bounding_box(bbox);
-		// Layer ID is used for orienting the infill in alternating directions.
-		// Layer::id() returns layer ID including raft layers, subtract them to make the infill direction independent
-		// from raft.
-        f->layer_id = this->id() - first_object_layer_id;
-        f->z 		= this->print_z;
-        f->angle 	= surface_fill.params.angle;
-        f->adapt_fill_octree   = (surface_fill.params.pattern == ipSupportCubic) ? support_fill_octree : adaptive_fill_octree;
-        f->print_config        = &this->object()->print()->config();
-        f->print_object_config = &this->object()->config();
-
-        if (surface_fill.params.pattern == ipLightning)
-            dynamic_cast<FillLightning::Filler*>(f.get())->generator = lightning_generator;
 
-        if (surface_fill.params.pattern == ipEnsuring) {
-            auto *fill_ensuring = dynamic_cast<FillEnsuring *>(f.get());
-            assert(fill_ensuring != nullptr);
-            fill_ensuring->print_region_config = &m_regions[surface_fill.region_id]->region().config();
-        }
+    // A fill job generates the infill pattern of a single island (expolygon) of a single surface fill.
+    // The jobs only produce polylines / thick polylines, the stateful bookkeeping (appending to the
+    // LayerRegion fills, assigning fills to islands) is done afterwards, serially and in the original
+    // deterministic order.
+    struct FillJob {
+        size_t         fill_idx;
+        size_t         island_idx;
+        Polylines      polylines;
+        ThickPolylines thick_polylines;
+        // Spacing of the generated pattern, after the filler possibly adjusted it.
+        coordf_t       spacing { 0. };
+        bool           no_sort { false };
+        bool           is_self_crossing { false };
+    };
+    std::vector<FillJob> fill_jobs;
+    for (size_t fill_idx = 0; fill_idx < surface_fills.size(); ++ fill_idx)
+        for (size_t island_idx = 0; island_idx < surface_fills[fill_idx].expolygons.size(); ++ island_idx)
+            fill_jobs.push_back({ fill_idx, island_idx });
+
+    // Fillers are stateful (the pattern generators adjust their spacing), therefore each job constructs
+    // its own instance. The fillers are cheap to build compared to the patterns they generate and one
+    // instance per island lets the islands of a plate with a single huge object be filled in parallel, too.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, fill_jobs.size()),
+        [this, &surface_fills, &fill_jobs, &bbox, resolution, perimeter_generator,
+         adaptive_fill_octree, support_fill_octree, lightning_generator, first_object_layer_id](const tbb::blocked_range<size_t> &range) {
+        for (size_t job_idx = range.begin(); job_idx < range.end(); ++ job_idx) {
+            FillJob     &job          = fill_jobs[job_idx];
+            SurfaceFill &surface_fill = surface_fills[job.fill_idx];
+            // Create the filler object.
+            std::unique_ptr<Fill> f = std::unique_ptr<Fill>(Fill::new_from_type(surface_fill.params.pattern));
+            f->set_bounding_box(bbox);
+            // Layer ID is used for orienting the infill in alternating directions.
+            // Layer::id() returns layer ID including raft layers, subtract them to make the infill direction independent
+            // from raft.
+            f->layer_id = this->id() - first_object_layer_id;
+            f->z        = this->print_z;
+            f->angle    = surface_fill.params.angle;
+            f->adapt_fill_octree   = (surface_fill.params.pattern == ipSupportCubic) ? support_fill_octree : adaptive_fill_octree;
+            f->print_config        = &this->object()->print()->config();
+            f->print_object_config = &this->object()->config();
+
+            if (surface_fill.params.pattern == ipLightning)
+                dynamic_cast<FillLightning::Filler*>(f.get())->generator = lightning_generator;
+
+            if (surface_fill.params.pattern == ipEnsuring) {
+                auto *fill_ensuring = dynamic_cast<FillEnsuring *>(f.get());
+                assert(fill_ensuring != nullptr);
+                fill_ensuring->print_region_config = &m_regions[surface_fill.region_id]->region().config();
+            }
 
-        // calculate flow spacing for infill pattern generation
-        bool using_internal_flow = ! surface_fill.surface.is_solid() && ! surface_fill.params.bridge;
-        double link_max_length = 0.;
-        if (! surface_fill.params.bridge) {
+            // calculate flow spacing for infill pattern generation
+            double link_max_length = 0.;
+            if (! surface_fill.params.bridge) {
 #if 0
-            link_max_length = layerm.region()->config().get_abs_value(surface.is_external() ? "external_fill_link_max_length" : "fill_link_max_length", flow.spacing());
-//            printf("flow spacing: %f,  is_external: %d, link_max_length: %lf\n", flow.spacing(), int(surface.is_external()), link_max_length);
+                link_max_length = layerm.region()->config().get_abs_value(surface.is_external() ? "external_fill_link_max_length" : "fill_link_max_length", flow.spacing());
+//                printf("flow spacing: %f,  is_external: %d, link_max_length: %lf\n", flow.spacing(), int(surface.is_external()), link_max_length);
 #else
-            if (surface_fill.params.density > 80.) // 80%
-                link_max_length = 3. * f->spacing;
+                if (surface_fill.params.density > 80.) // 80%
+                    link_max_length = 3. * f->spacing;
 #endif
-        }
-
-        // Maximum length of the perimeter segment linking two infill lines.
-        f->link_max_length = (coord_t)scale_(link_max_length);
-        // Used by the concentric infill pattern to clip the loops to create extrusion paths.
-        f->loop_clipping = coord_t(scale_(surface_fill.params.flow.nozzle_diameter()) * LOOP_CLIPPING_LENGTH_OVER_NOZZLE_DIAMETER);
-
-        LayerRegion &layerm = *m_regions[surface_fill.region_id];
+            }
 
-        // apply half spacing using this flow's own spacing and generate infill
-        FillParams params;
-        params.density                    = float(0.01 * surface_fill.params.density);
-        params.dont_adjust                = false; //  surface_fill.params.dont_adjust;
-        params.anchor_length              = surface_fill.params.anchor_length;
-        params.anchor_length_max          = surface_fill.params.anchor_length_max;
-        params.resolution                 = resolution;
-        params.use_arachne                = (perimeter_generator == PerimeterGeneratorType::Arachne && surface_fill.params.pattern == ipConcentric) || surface_fill.params.pattern == ipEnsuring;
-        params.layer_height               = layerm.layer()->height;
-        params.prefer_clockwise_movements = this->object()->print()->config().prefer_clockwise_movements;
+            // Maximum length of the perimeter segment linking two infill lines.
+            f->link_max_length = (coord_t)scale_(link_max_length);
+            // Used by the concentric infill pattern to clip the loops to create extrusion paths.
+            f->loop_clipping = coord_t(scale_(surface_fill.params.flow.nozzle_diameter()) * LOOP_CLIPPING_LENGTH_OVER_NOZZLE_DIAMETER);
+
+            // apply half spacing using this flow's own spacing and generate infill
+            FillParams params;
+            params.density                    = float(0.01 * surface_fill.params.density);
+            params.dont_adjust                = false; //  surface_fill.params.dont_adjust;
+            params.anchor_length              = surface_fill.params.anchor_length;
+            params.anchor_length_max          = surface_fill.params.anchor_length_max;
+            params.resolution                 = resolution;
+            params.use_arachne                = (perimeter_generator == PerimeterGeneratorType::Arachne && surface_fill.params.pattern == ipConcentric) || surface_fill.params.pattern == ipEnsuring;
+            params.layer_height               = m_regions[surface_fill.region_id]->layer()->height;
+            params.prefer_clockwise_movements = this->object()->print()->config().prefer_clockwise_movements;
 
-        for (ExPolygon &expoly : surface_fill.expolygons) {
-			// Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
-			f->spacing = surface_fill.params.spacing;
-			surface_fill.surface.expolygon = std::move(expoly);
-            Polylines      polylines;
-            ThickPolylines thick_polylines;
-			try {
+            // Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
+            f->spacing = surface_fill.params.spacing;
+            Surface surface(surface_fill.surface, std::move(surface_fill.expolygons[job.island_idx]));
+            try {
                 if (params.use_arachne)
-                    thick_polylines = f->fill_surface_arachne(&surface_fill.surface, params);
+                    job.thick_polylines = f->fill_surface_arachne(&surface, params);
                 else
-				    polylines = f->fill_surface(&surface_fill.surface, params);
-			} catch (InfillFailedException &) {
-			}
-            if (!polylines.empty() || !thick_polylines.empty()) {
-                // calculate actual flow from spacing (which might have been adjusted by the infill
-		        // pattern generator)
-		        double flow_mm3_per_mm = surface_fill.params.flow.mm3_per_mm();
-		        double flow_width      = surface_fill.params.flow.width();
-		        if (using_internal_flow) {
-		            // if we used the internal flow we're not doing a solid infill
-		            // so we can safely ignore the slight variation that might have
-		            // been applied to f->spacing
-		        } else {
-		            Flow new_flow   = surface_fill.params.flow.with_spacing(float(f->spacing));
-		        	flow_mm3_per_mm = new_flow.mm3_per_mm();
-		        	flow_width      = new_flow.width();
-		        }
-                // Save into layer.
-                ExtrusionEntityCollection *eec        = new ExtrusionEntityCollection();
-                auto                       fill_begin = uint32_t(layerm.fills().size());
-                // Only concentric fills are not sorted.
-                eec->no_sort = f->no_sort();
-                if (params.use_arachne) {
-                    for (const ThickPolyline &thick_polyline : thick_polylines) {
-                        Flow new_flow = surface_fill.params.flow.with_spacing(float(f->spacing));
-
-                        ExtrusionMultiPath multi_path = PerimeterGenerator::thick_polyline_to_multi_path(thick_polyline, surface_fill.params.extrusion_role, new_flow, scaled<float>(0.05), float(SCALED_EPSILON));
-                        // Append paths to collection.
-                        if (!multi_path.empty()) {
-                            if (multi_path.paths.front().first_point() == multi_path.paths.back().last_point())
-                                eec->entities.emplace_back(new ExtrusionLoop(std::move(multi_path.paths)));
-                            else
-                                eec->entities.emplace_back(new ExtrusionMultiPath(std::move(multi_path)));
-                        }
-                    }
-
-                    if (!eec->empty())
-                        layerm.m_fills.entities.push_back(eec);
+                    job.polylines = f->fill_surface(&surface, params);
+            } catch (InfillFailedException &) {
+            }
+            job.spacing          = f->spacing;
+            job.no_sort          = f->no_sort();
+            job.is_self_crossing = f->is_self_crossing();
+        }
+    });
+
+    // Convert the generated patterns into extrusions, save them into the layer regions
+    // and assign them to islands.
+    const bool prefer_clockwise_movements = this->object()->print()->config().prefer_clockwise_movements;
+    for (FillJob &job : fill_jobs) {
+        if (job.polylines.empty() && job.thick_polylines.empty())
+            continue;
+        SurfaceFill &surface_fill = surface_fills[job.fill_idx];
+        LayerRegion &layerm       = *m_regions[surface_fill.region_id];
+        const bool   use_arachne  = (perimeter_generator == PerimeterGeneratorType::Arachne && surface_fill.params.pattern == ipConcentric) || surface_fill.params.pattern == ipEnsuring;
+        const bool   using_internal_flow = ! surface_fill.surface.is_solid() && ! surface_fill.params.bridge;
+        // calculate actual flow from spacing (which might have been adjusted by the infill
+        // pattern generator)
+        double flow_mm3_per_mm = surface_fill.params.flow.mm3_per_mm();
+        double flow_width      = surface_fill.params.flow.width();
+        if (using_internal_flow) {
+            // if we used the internal flow we're not doing a solid infill
+            // so we can safely ignore the slight variation that might have
+            // been applied to f->spacing
+        } else {
+            Flow new_flow   = surface_fill.params.flow.with_spacing(float(job.spacing));
+            flow_mm3_per_mm = new_flow.mm3_per_mm();
+            flow_width      = new_flow.width();
+        }
+        // Save into layer.
+        ExtrusionEntityCollection *eec        = new ExtrusionEntityCollection();
+        auto                       fill_begin = uint32_t(layerm.fills().size());
+        // Only concentric fills are not sorted.
+        eec->no_sort = job.no_sort;
+        if (use_arachne) {
+            for (const ThickPolyline &thick_polyline : job.thick_polylines) {
+                Flow new_flow = surface_fill.params.flow.with_spacing(float(job.spacing));
+
+                ExtrusionMultiPath multi_path = PerimeterGenerator::thick_polyline_to_multi_path(thick_polyline, surface_fill.params.extrusion_role, new_flow, scaled<float>(0.05), float(SCALED_EPSILON));
+                // Append paths to collection.
+                if (!multi_path.empty()) {
+                    if (multi_path.paths.front().first_point() == multi_path.paths.back().last_point())
+                        eec->entities.emplace_back(new ExtrusionLoop(std::move(multi_path.paths)));
                     else
-                        delete eec;
-
-                    thick_polylines.clear();
-                } else {
-                    // When prefer_clockwise_movements is true, we have to ensure that extrusion paths will not be reversed during path planning.
-                    extrusion_entities_append_paths(
-                        eec->entities, std::move(polylines),
-						ExtrusionAttributes{
-                            surface_fill.params.extrusion_role,
-							ExtrusionFlow{ flow_mm3_per_mm, float(flow_width), surface_fill.params.flow.height() },
-                            f->is_self_crossing()
-						}, !params.prefer_clockwise_movements);
-                    layerm.m_fills.entities.push_back(eec);
+                        eec->entities.emplace_back(new ExtrusionMultiPath(std::move(multi_path)));
                 }
-                insert_fills_into_islands(*this, uint32_t(surface_fill.region_id), fill_begin, uint32_t(layerm.fills().size()));
-		    }
-		}
+            }
+
+            if (!eec->empty())
+                layerm.m_fills.entities.push_back(eec);
+            else
+                delete eec;
+
+            job.thick_polylines.clear();
+        } else {
+            // When prefer_clockwise_movements is true, we have to ensure that extrusion paths will not be reversed during path planning.
+            extrusion_entities_append_paths(
+                eec->entities, std::move(job.polylines),
+                ExtrusionAttributes{
+                    surface_fill.params.extrusion_role,
+                    ExtrusionFlow{ flow_mm3_per_mm, float(flow_width), surface_fill.params.flow.height() },
+                    job.is_self_crossing
+                }, !prefer_clockwise_movements);
+            layerm.m_fills.entities.push_back(eec);
+        }
+        insert_fills_into_islands(*this, uint32_t(surface_fill.region_id), fill_begin, uint32_t(layerm.fills().size()));
     }
 
 	for (LayerSlice &lslice : this->lslices_ex)
@@ -25,7 +25,8 @@ static inline double f(double x, double z_sin, double z_cos, bool vertical, bool
         double phase_offset = (z_cos < 0 ? M_PI : 0) + M_PI;
         double a   = sin(x + phase_offset);
         double b   = - z_cos;
-        double res = z_sin * cos(x + phase_offset + (flip ? M_PI : 0.));
+        // cos(x + phase_offset + M_PI) == - cos(x + phase_offset), avoid the second trigonometric call.
+        double res = z_sin * (flip ? - cos(x + phase_offset) : cos(x + phase_offset));
         double r   = sqrt(sqr(a) + sqr(b));
         return asin(a/r) + asin(res/r) + M_PI;
     }
@@ -33,14 +34,17 @@ static inline double f(double x, double z_sin, double z_cos, bool vertical, bool
         double phase_offset = z_sin < 0 ? M_PI : 0.;
         double a   = cos(x + phase_offset);
         double b   = - z_sin;
-        double res = z_cos * sin(x + phase_offset + (flip ? 0 : M_PI));
+        // sin(x + phase_offset + M_PI) == - sin(x + phase_offset), avoid the second trigonometric call.
+        double res = z_cos * (flip ? sin(x + phase_offset) : - sin(x + phase_offset));
         double r   = sqrt(sqr(a) + sqr(b));
         return (asin(a/r) + asin(res/r) + 0.5 * M_PI);
     }
 }
 
-static inline Polyline make_wave(
-    const std::vector<Vec2d>& one_period, double width, double height, double offset, double scaleFactor,
+// Extend one period of the wave to the full width of the pattern. All the waves of the same parity are
+// offset copies of the extended wave, so this only has to run once per parity instead of once per wave.
+static std::vector<Vec2d> extend_period(
+    const std::vector<Vec2d>& one_period, double width,
     double z_cos, double z_sin, bool vertical, bool flip)
 {
     std::vector<Vec2d> points = one_period;
@@ -57,16 +61,20 @@ static inline Polyline make_wave(
 
         points.emplace_back(Vec2d(width, f(width, z_sin, z_cos, vertical, flip)));
     }
+    return points;
+}
 
-    // and construct the final polyline to return:
+static inline Polyline make_wave(
+    const std::vector<Vec2d>& extended_period, double height, double offset, double scaleFactor, bool vertical)
+{
+    // construct the final polyline to return:
     Polyline polyline;
-    polyline.points.reserve(points.size());
-    for (auto& point : points) {
-        point(1) += offset;
-        point(1) = std::clamp(double(point.y()), 0., height);
+    polyline.points.reserve(extended_period.size());
+    for (const Vec2d &point : extended_period) {
+        Vec2d p(point.x(), std::clamp(point.y() + offset, 0., height));
         if (vertical)
-            std::swap(point(0), point(1));
-        polyline.points.emplace_back((point * scaleFactor).cast<coord_t>());
+            std::swap(p(0), p(1));
+        polyline.points.emplace_back((p * scaleFactor).cast<coord_t>());
     }
 
     return polyline;
@@ -140,15 +148,18 @@ static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double
     std::vector<Vec2d> one_period_odd = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
     flip = !flip;                                                                   // even polylines are a bit shifted
     std::vector<Vec2d> one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance);
+    // Extend both periods to the full width once, every wave of the same parity is just an offset copy.
+    std::vector<Vec2d> extended_period_odd  = extend_period(one_period_odd, width, z_cos, z_sin, vertical, flip);
+    std::vector<Vec2d> extended_period_even = extend_period(one_period_even, width, z_cos, z_sin, vertical, flip);
     Polylines result;
 
     for (double y0 = lower_bound; y0 < upper_bound + EPSILON; y0 += M_PI) {
         // creates odd polylines
-        result.emplace_back(make_wave(one_period_odd, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
+        result.emplace_back(make_wave(extended_period_odd, height, y0, scaleFactor, vertical));
         // creates even polylines
         y0 += M_PI;
         if (y0 < upper_bound + EPSILON) {
-            result.emplace_back(make_wave(one_period_even, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
+            result.emplace_back(make_wave(extended_period_even, height, y0, scaleFactor, vertical));
         }
     }
 
@@ -3,6 +3,9 @@
 
 #include "Generator.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+
 #include <algorithm>
 #include <cmath>
 #include <utility>
@@ -147,9 +150,18 @@ void Generator::generateTrees(const PrintObject &print_object, const std::functi
         outlines_locator.set_bbox(below_outlines_bbox);
         outlines_locator.create(below_outlines, locator_cell_size);
 
-        std::vector<NodeSPtr>& lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
-        for (auto& tree : current_lightning_layer.tree_roots)
-            tree->propagateToNextLayer(lower_trees, below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+        // Each tree is pruned, straightened and realigned on a private deep copy, so the trees may be
+        // propagated in parallel. Collect the resulting roots per source tree and merge them serially
+        // in the original order to keep the output deterministic.
+        std::vector<NodeSPtr>             &lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
+        std::vector<std::vector<NodeSPtr>> propagated_trees(current_lightning_layer.tree_roots.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, current_lightning_layer.tree_roots.size()),
+            [this, &tree_roots = std::as_const(current_lightning_layer.tree_roots), &propagated_trees, &below_outlines = std::as_const(below_outlines), &outlines_locator = std::as_const(outlines_locator)](const tbb::blocked_range<size_t> &range) -> void {
+            for (size_t tree_idx = range.begin(); tree_idx < range.end(); ++ tree_idx)
+                tree_roots[tree_idx]->propagateToNextLayer(propagated_trees[tree_idx], below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+        });
+        for (std::vector<NodeSPtr> &trees : propagated_trees)
+            append(lower_trees, std::move(trees));
     }
 }
 
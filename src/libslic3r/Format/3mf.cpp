@@ -40,6 +40,10 @@ namespace pt = boost::property_tree;
 #include <LocalesUtils.hpp>
 
 #include "libslic3r/miniz_extension.hpp"
+#include "libslic3r/Thread.hpp"
+
+#include <tbb/parallel_pipeline.h>
+#include <tbb/task_arena.h>
 
 #include "libslic3r/TextConfiguration.hpp"
 #include "libslic3r/EmbossShape.hpp"
@@ -1802,7 +1806,13 @@ namespace Slic3r {
         bool res = true;
         unsigned int num_attributes = (unsigned int)XML_GetSpecifiedAttributeCount(m_xml_parser);
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        // Vertices and triangles are by far the most frequent elements,
+        // test for them first.
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_start_vertex(attributes, num_attributes);
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_start_triangle(attributes, num_attributes);
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_start_model(attributes, num_attributes);
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_start_resources(attributes, num_attributes);
@@ -1812,12 +1822,8 @@ namespace Slic3r {
             res = _handle_start_mesh(attributes, num_attributes);
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_start_vertices(attributes, num_attributes);
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_start_vertex(attributes, num_attributes);
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_start_triangles(attributes, num_attributes);
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_start_triangle(attributes, num_attributes);
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_start_components(attributes, num_attributes);
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -1840,7 +1846,13 @@ namespace Slic3r {
 
         bool res = true;
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        // Vertices and triangles are by far the most frequent elements,
+        // test for them first.
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_end_vertex();
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_end_triangle();
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_end_model();
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_end_resources();
@@ -1850,12 +1862,8 @@ namespace Slic3r {
             res = _handle_end_mesh();
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_end_vertices();
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_end_vertex();
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_end_triangles();
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_end_triangle();
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_end_components();
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -2073,10 +2081,22 @@ namespace Slic3r {
     {
         // appends the vertex coordinates
         // missing values are set equal to ZERO
-        m_curr_object.geometry.vertices.emplace_back(
-            m_unit_factor * get_attribute_value_float(attributes, num_attributes, X_ATTR),
-            m_unit_factor * get_attribute_value_float(attributes, num_attributes, Y_ATTR),
-            m_unit_factor * get_attribute_value_float(attributes, num_attributes, Z_ATTR));
+        // This is the hottest path of the model parser, scan the attribute
+        // list just once instead of once per coordinate.
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        for (unsigned int a = 0; a + 1 < num_attributes; a += 2) {
+            const char* key = attributes[a];
+            if (key[0] != '\0' && key[1] == '\0') {
+                float* coord = (key[0] == 'x') ? &x : (key[0] == 'y') ? &y : (key[0] == 'z') ? &z : nullptr;
+                if (coord != nullptr) {
+                    const char* text = attributes[a + 1];
+                    fast_float::from_chars(text, text + ::strlen(text), *coord);
+                }
+            }
+        }
+        m_curr_object.geometry.vertices.emplace_back(m_unit_factor * x, m_unit_factor * y, m_unit_factor * z);
         return true;
     }
 
@@ -2110,22 +2130,48 @@ namespace Slic3r {
 
         // appends the triangle's vertices indices
         // missing values are set equal to ZERO
-        m_curr_object.geometry.triangles.emplace_back(
-            get_attribute_value_int(attributes, num_attributes, V1_ATTR),
-            get_attribute_value_int(attributes, num_attributes, V2_ATTR),
-            get_attribute_value_int(attributes, num_attributes, V3_ATTR));
+        // Scan the attribute list just once instead of once per attribute,
+        // this runs for every triangle of the model.
+        int v1 = 0;
+        int v2 = 0;
+        int v3 = 0;
+        const char* custom_supports = nullptr;
+        const char* custom_seam     = nullptr;
+        const char* fuzzy_skin      = nullptr;
+        const char* mm_segmentation = nullptr;
+        const char* paint_color     = nullptr;
+        for (unsigned int a = 0; a + 1 < num_attributes; a += 2) {
+            const char* key  = attributes[a];
+            const char* text = attributes[a + 1];
+            if (key[0] == 'v' && key[1] != '\0' && key[2] == '\0') {
+                int* vertex = (key[1] == '1') ? &v1 : (key[1] == '2') ? &v2 : (key[1] == '3') ? &v3 : nullptr;
+                if (vertex != nullptr)
+                    boost::spirit::qi::parse(text, text + ::strlen(text), boost::spirit::qi::int_, *vertex);
+            }
+            else if (::strcmp(key, CUSTOM_SUPPORTS_ATTR) == 0)
+                custom_supports = text;
+            else if (::strcmp(key, CUSTOM_SEAM_ATTR) == 0)
+                custom_seam = text;
+            else if (::strcmp(key, FUZZY_SKIN_ATTR) == 0)
+                fuzzy_skin = text;
+            else if (::strcmp(key, MM_SEGMENTATION_ATTR) == 0)
+                mm_segmentation = text;
+            else if (::strcmp(key, "paint_color") == 0)
+                paint_color = text;
+        }
 
-        m_curr_object.geometry.custom_supports.push_back(get_attribute_value_string(attributes, num_attributes, CUSTOM_SUPPORTS_ATTR));
-        m_curr_object.geometry.custom_seam.push_back(get_attribute_value_string(attributes, num_attributes, CUSTOM_SEAM_ATTR));
-        m_curr_object.geometry.fuzzy_skin.push_back(get_attribute_value_string(attributes, num_attributes, FUZZY_SKIN_ATTR));
+        m_curr_object.geometry.triangles.emplace_back(v1, v2, v3);
+
+        m_curr_object.geometry.custom_supports.emplace_back(custom_supports != nullptr ? custom_supports : "");
+        m_curr_object.geometry.custom_seam.emplace_back(custom_seam != nullptr ? custom_seam : "");
+        m_curr_object.geometry.fuzzy_skin.emplace_back(fuzzy_skin != nullptr ? fuzzy_skin : "");
 
         // Now load MM segmentation data. Unfortunately, BambuStudio has changed the attribute name after they forked us,
         // leading to https://github.com/prusa3d/PrusaSlicer/issues/12502. Let's try to load both keys if the usual
         // one that PrusaSlicer uses is not present.
-        std::string mm_segmentation_serialized = get_attribute_value_string(attributes, num_attributes, MM_SEGMENTATION_ATTR);
-        if (mm_segmentation_serialized.empty())
-            mm_segmentation_serialized = get_attribute_value_string(attributes, num_attributes, "paint_color");
-        m_curr_object.geometry.mm_segmentation.push_back(mm_segmentation_serialized);
+        if (mm_segmentation == nullptr || *mm_segmentation == '\0')
+            mm_segmentation = paint_color;
+        m_curr_object.geometry.mm_segmentation.emplace_back(mm_segmentation != nullptr ? mm_segmentation : "");
 
         return true;
     }
@@ -3178,23 +3224,28 @@ namespace Slic3r {
 
     bool _3MF_Exporter::_add_mesh_to_object_stream(mz_zip_writer_staged_context &context, ModelObject& object, VolumeToOffsetsMap& volumes_offsets)
     {
-        std::string output_buffer;
-        output_buffer += "   <";
-        output_buffer += MESH_TAG;
-        output_buffer += ">\n    <";
-        output_buffer += VERTICES_TAG;
-        output_buffer += ">\n";
-
-        auto flush = [this, &output_buffer, &context](bool force = false) {
-            if ((force && ! output_buffer.empty()) || output_buffer.size() >= 65536 * 16) {
-                if (! mz_zip_writer_add_staged_data(&context, output_buffer.data(), output_buffer.size())) {
-                    add_error("Error during writing or compression");
-                    return false;
-                }
-                output_buffer.clear();
+        // Compute the vertex and triangle offsets of all volumes upfront, the XML
+        // serialization of the mesh chunks below is then independent and can run
+        // on worker threads.
+        unsigned int vertices_count = 0;
+        unsigned int triangles_count = 0;
+        for (ModelVolume* volume : object.volumes) {
+            if (volume == nullptr)
+                continue;
+
+            const indexed_triangle_set &its = volume->mesh().its;
+            if (its.vertices.empty()) {
+                add_error("Found invalid mesh");
+                return false;
             }
-            return true;
-        };
+
+            Offsets offsets(vertices_count);
+            vertices_count += (int)its.vertices.size();
+            offsets.first_triangle_id = triangles_count;
+            triangles_count += (int)its.indices.size();
+            offsets.last_triangle_id = triangles_count - 1;
+            volumes_offsets.insert({ volume, offsets });
+        }
 
         auto format_coordinate = [](float f, char *buf) -> char* {
             assert(is_decimal_separator_point());
@@ -3226,128 +3277,188 @@ namespace Slic3r {
 #endif
         };
 
-        char buf[256];
-        unsigned int vertices_count = 0;
-        for (ModelVolume* volume : object.volumes) {
-            if (volume == nullptr)
-                continue;
-
-            volumes_offsets.insert({ volume, Offsets(vertices_count) });
+        // A chunk of the mesh XML stream: a range of vertices or triangles of one
+        // volume. The deflate of the single model stream has to stay serial, thus
+        // the XML text of the chunks is generated on worker threads and handed
+        // over to the staged zip writer in order, similarly to the G-code export
+        // pipeline in GCodeGenerator::process_layers().
+        struct Chunk {
+            const ModelVolume *volume;
+            size_t             begin;
+            size_t             end;
+            bool               is_triangles;
+        };
+        static constexpr const size_t chunk_max = 16384;
 
-            const indexed_triangle_set &its = volume->mesh().its;
-            if (its.vertices.empty()) {
-                add_error("Found invalid mesh");
-                return false;
+        std::vector<Chunk> chunks;
+        for (int phase = 0; phase < 2; ++ phase)
+            for (const ModelVolume *volume : object.volumes) {
+                if (volume == nullptr)
+                    continue;
+                const indexed_triangle_set &its = volume->mesh().its;
+                size_t cnt = phase == 0 ? its.vertices.size() : its.indices.size();
+                for (size_t begin = 0; begin < cnt; begin += chunk_max)
+                    chunks.push_back({ volume, begin, std::min(begin + chunk_max, cnt), phase != 0 });
             }
 
-            vertices_count += (int)its.vertices.size();
-
-            const Transform3d& matrix = volume->get_matrix();
-            for (const auto& vertex: its.vertices) {
-                Vec3f v = (matrix * vertex.cast<double>()).cast<float>();
-                char *ptr = buf;
-                boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << VERTEX_TAG << " x=\"");
-                ptr = format_coordinate(v.x(), ptr);
-                boost::spirit::karma::generate(ptr, "\" y=\"");
-                ptr = format_coordinate(v.y(), ptr);
-                boost::spirit::karma::generate(ptr, "\" z=\"");
-                ptr = format_coordinate(v.z(), ptr);
-                boost::spirit::karma::generate(ptr, "\"/>\n");
-                *ptr = '\0';
-                output_buffer += buf;
-                if (! flush())
-                    return false;
-            }
-        }
+        auto serialize_chunk = [&volumes_offsets, &format_coordinate](const Chunk &chunk, std::string &out) {
+            char buf[256];
+            const indexed_triangle_set &its = chunk.volume->mesh().its;
+            out.reserve(out.size() + 64 * (chunk.end - chunk.begin));
+            if (! chunk.is_triangles) {
+                const Transform3d& matrix = chunk.volume->get_matrix();
+                for (size_t i = chunk.begin; i < chunk.end; ++ i) {
+                    Vec3f v = (matrix * its.vertices[i].cast<double>()).cast<float>();
+                    char *ptr = buf;
+                    boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << VERTEX_TAG << " x=\"");
+                    ptr = format_coordinate(v.x(), ptr);
+                    boost::spirit::karma::generate(ptr, "\" y=\"");
+                    ptr = format_coordinate(v.y(), ptr);
+                    boost::spirit::karma::generate(ptr, "\" z=\"");
+                    ptr = format_coordinate(v.z(), ptr);
+                    boost::spirit::karma::generate(ptr, "\"/>\n");
+                    *ptr = '\0';
+                    out += buf;
+                }
+            } else {
+                const ModelVolume *volume = chunk.volume;
+                bool is_left_handed = volume->is_left_handed();
+                VolumeToOffsetsMap::const_iterator volume_it = volumes_offsets.find(volume);
+                assert(volume_it != volumes_offsets.end());
 
-        output_buffer += "    </";
-        output_buffer += VERTICES_TAG;
-        output_buffer += ">\n    <";
-        output_buffer += TRIANGLES_TAG;
-        output_buffer += ">\n";
+                for (int i = int(chunk.begin); i < int(chunk.end); ++ i) {
+                    {
+                        const Vec3i &idx = its.indices[i];
+                        char *ptr = buf;
+                        boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << TRIANGLE_TAG <<
+                            " v1=\"" << boost::spirit::int_ <<
+                            "\" v2=\"" << boost::spirit::int_ <<
+                            "\" v3=\"" << boost::spirit::int_ << "\"",
+                            idx[is_left_handed ? 2 : 0] + volume_it->second.first_vertex_id,
+                            idx[1] + volume_it->second.first_vertex_id,
+                            idx[is_left_handed ? 0 : 2] + volume_it->second.first_vertex_id);
+                        *ptr = '\0';
+                        out += buf;
+                    }
 
-        unsigned int triangles_count = 0;
-        for (ModelVolume* volume : object.volumes) {
-            if (volume == nullptr)
-                continue;
+                    std::string custom_supports_data_string = volume->supported_facets.get_triangle_as_string(i);
+                    if (! custom_supports_data_string.empty()) {
+                        out += " ";
+                        out += CUSTOM_SUPPORTS_ATTR;
+                        out += "=\"";
+                        out += custom_supports_data_string;
+                        out += "\"";
+                    }
 
-            bool is_left_handed = volume->is_left_handed();
-            VolumeToOffsetsMap::iterator volume_it = volumes_offsets.find(volume);
-            assert(volume_it != volumes_offsets.end());
+                    std::string custom_seam_data_string = volume->seam_facets.get_triangle_as_string(i);
+                    if (! custom_seam_data_string.empty()) {
+                        out += " ";
+                        out += CUSTOM_SEAM_ATTR;
+                        out += "=\"";
+                        out += custom_seam_data_string;
+                        out += "\"";
+                    }
 
-            const indexed_triangle_set &its = volume->mesh().its;
+                    std::string mm_painting_data_string = volume->mm_segmentation_facets.get_triangle_as_string(i);
+                    if (! mm_painting_data_string.empty()) {
+                        out += " ";
+                        out += MM_SEGMENTATION_ATTR;
+                        out += "=\"";
+                        out += mm_painting_data_string;
+                        out += "\"";
+                    }
 
-            // updates triangle offsets
-            volume_it->second.first_triangle_id = triangles_count;
-            triangles_count += (int)its.indices.size();
-            volume_it->second.last_triangle_id = triangles_count - 1;
+                    std::string fuzzy_skin_data_string = volume->fuzzy_skin_facets.get_triangle_as_string(i);
+                    if (!fuzzy_skin_data_string.empty()) {
+                        out += " ";
+                        out += FUZZY_SKIN_ATTR;
+                        out += "=\"";
+                        out += fuzzy_skin_data_string;
+                        out += "\"";
+                    }
 
-            for (int i = 0; i < int(its.indices.size()); ++ i) {
-                {
-                    const Vec3i &idx = its.indices[i];
-                    char *ptr = buf;
-                    boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << TRIANGLE_TAG <<
-                        " v1=\"" << boost::spirit::int_ <<
-                        "\" v2=\"" << boost::spirit::int_ <<
-                        "\" v3=\"" << boost::spirit::int_ << "\"",
-                        idx[is_left_handed ? 2 : 0] + volume_it->second.first_vertex_id,
-                        idx[1] + volume_it->second.first_vertex_id,
-                        idx[is_left_handed ? 0 : 2] + volume_it->second.first_vertex_id);
-                    *ptr = '\0';
-                    output_buffer += buf;
+                    out += "/>\n";
                 }
+            }
+        };
 
-                std::string custom_supports_data_string = volume->supported_facets.get_triangle_as_string(i);
-                if (! custom_supports_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += CUSTOM_SUPPORTS_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += custom_supports_data_string;
-                    output_buffer += "\"";
-                }
+        auto write_text = [this, &context](const std::string &text) {
+            if (! mz_zip_writer_add_staged_data(&context, text.data(), text.size())) {
+                add_error("Error during writing or compression");
+                return false;
+            }
+            return true;
+        };
 
-                std::string custom_seam_data_string = volume->seam_facets.get_triangle_as_string(i);
-                if (! custom_seam_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += CUSTOM_SEAM_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += custom_seam_data_string;
-                    output_buffer += "\"";
-                }
+        std::string head;
+        head += "   <";
+        head += MESH_TAG;
+        head += ">\n    <";
+        head += VERTICES_TAG;
+        head += ">\n";
+        if (! write_text(head))
+            return false;
 
-                std::string mm_painting_data_string = volume->mm_segmentation_facets.get_triangle_as_string(i);
-                if (! mm_painting_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += MM_SEGMENTATION_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += mm_painting_data_string;
-                    output_buffer += "\"";
-                }
+        std::string separator;
+        separator += "    </";
+        separator += VERTICES_TAG;
+        separator += ">\n    <";
+        separator += TRIANGLES_TAG;
+        separator += ">\n";
+
+        // The vertices / triangles section separator is emitted with the first
+        // triangle chunk, or with the tail if there are no triangles at all.
+        size_t first_triangle_chunk = chunks.size();
+        for (size_t i = 0; i < chunks.size(); ++ i)
+            if (chunks[i].is_triangles) {
+                first_triangle_chunk = i;
+                break;
+            }
 
-                std::string fuzzy_skin_data_string = volume->fuzzy_skin_facets.get_triangle_as_string(i);
-                if (!fuzzy_skin_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += FUZZY_SKIN_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += fuzzy_skin_data_string;
-                    output_buffer += "\"";
+        size_t feed_idx = 0;
+        bool   failed   = false;
+        const auto chunk_feeder = tbb::make_filter<void, size_t>(tbb::filter_mode::serial_in_order,
+            [&feed_idx, &chunks, &failed](tbb::flow_control &fc) -> size_t {
+                if (failed || feed_idx >= chunks.size()) {
+                    fc.stop();
+                    return 0;
                 }
+                return feed_idx ++;
+            });
+        const auto chunk_serializer = tbb::make_filter<size_t, std::string>(tbb::filter_mode::parallel,
+            [&chunks, &serialize_chunk, &separator, first_triangle_chunk](size_t idx) -> std::string {
+                std::string out;
+                if (idx == first_triangle_chunk)
+                    out = separator;
+                serialize_chunk(chunks[idx], out);
+                return out;
+            });
+        const auto chunk_writer = tbb::make_filter<std::string, void>(tbb::filter_mode::serial_in_order,
+            [this, &context, &failed](const std::string &text) {
+                if (! failed && ! text.empty() && ! mz_zip_writer_add_staged_data(&context, text.data(), text.size())) {
+                    add_error("Error during writing or compression");
+                    failed = true;
+                }
+            });
 
-                output_buffer += "/>\n";
-
-                if (! flush())
-                    return false;
-            }
-        }
+        // It registers a handler that sets locales to "C" before any TBB thread starts participating in tbb::parallel_pipeline.
+        // Handler is unregistered when the destructor is called.
+        TBBLocalesSetter locales_setter;
+        tbb::parallel_pipeline(std::max(size_t(12), size_t(2) * tbb::this_task_arena::max_concurrency()),
+                               chunk_feeder & chunk_serializer & chunk_writer);
 
-        output_buffer += "    </";
-        output_buffer += TRIANGLES_TAG;
-        output_buffer += ">\n   </";
-        output_buffer += MESH_TAG;
-        output_buffer += ">\n";
+        if (failed)
+            return false;
 
-        // Force flush.
-        return flush(true);
+        std::string tail;
+        if (first_triangle_chunk == chunks.size())
+            tail += separator;
+        tail += "    </";
+        tail += TRIANGLES_TAG;
+        tail += ">\n   </";
+        tail += MESH_TAG;
+        tail += ">\n";
+        return write_text(tail);
     }
 
     void _3MF_Exporter::add_transformation(std::stringstream &stream, const Transform3d &tr)
@@ -9,9 +9,12 @@
 ///|/
 #include <limits>
 #include <string.h>
+#include <cctype>
+#include <charconv>
 #include <map>
 #include <string>
 #include <expat.h>
+#include <fast_float.h>
 
 #include <boost/nowide/cstdio.hpp>
 
@@ -66,6 +69,30 @@ const char* SLIC3R_CONFIG_TYPE = "slic3rpe_config";
 namespace Slic3r
 {
 
+// Fast locale independent conversions of the accumulated XML character data, called for every
+// vertex coordinate and face index of the mesh. The strings may carry surrounding whitespace,
+// which the atof() / atoi() calls used before tolerated.
+static float float_from_chars(const std::string &str)
+{
+    const char *begin = str.c_str();
+    const char *end   = begin + str.size();
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+        ++ begin;
+    float out = 0.f;
+    fast_float::from_chars(begin, end, out);
+    return out;
+}
+
+static int int_from_chars(const std::string &str)
+{
+    const char *begin = str.c_str();
+    const char *end   = begin + str.size();
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+        ++ begin;
+    int out = 0;
+    std::from_chars(begin, end, out);
+    return out;
+}
 
 struct AMFParserContext
 {
@@ -608,7 +635,7 @@ void AMFParserContext::endElement(const char * /* name */)
     case NODE_TYPE_VERTEX:
         assert(m_object);
         // Parse the vertex data
-        m_object_vertices.emplace_back(float(atof(m_value[0].c_str())), float(atof(m_value[1].c_str())), float(atof(m_value[2].c_str())));
+        m_object_vertices.emplace_back(float_from_chars(m_value[0]), float_from_chars(m_value[1]), float_from_chars(m_value[2]));
         m_value[0].clear();
         m_value[1].clear();
         m_value[2].clear();
@@ -617,7 +644,7 @@ void AMFParserContext::endElement(const char * /* name */)
     // Faces of the current volume:
     case NODE_TYPE_TRIANGLE:
         assert(m_object && m_volume);
-        m_volume_facets.emplace_back(atoi(m_value[0].c_str()), atoi(m_value[1].c_str()), atoi(m_value[2].c_str()));
+        m_volume_facets.emplace_back(int_from_chars(m_value[0]), int_from_chars(m_value[1]), int_from_chars(m_value[2]));
         m_value[0].clear();
         m_value[1].clear();
         m_value[2].clear();
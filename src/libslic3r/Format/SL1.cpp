@@ -8,6 +8,7 @@
 #include <boost/filesystem.hpp>
 
 #include <sstream>
+#include <cstring>
 
 #include "libslic3r/Time.hpp"
 #include "libslic3r/Zipper.hpp"
@@ -290,10 +291,11 @@ static void write_thumbnail(Zipper &zipper, const ThumbnailData &data)
          &png_size, MZ_DEFAULT_LEVEL, 1);
 
     if (png_data != nullptr) {
+        // The PNG data is deflated already, just store it.
         zipper.add_entry("thumbnail/thumbnail" + std::to_string(data.width) +
                              "x" + std::to_string(data.height) + ".png",
                          static_cast<const std::uint8_t *>(png_data),
-                         png_size);
+                         png_size, Zipper::NO_COMPRESSION);
 
         mz_free(png_data);
     }
@@ -331,7 +333,15 @@ void SL1Archive::export_print(Zipper               &zipper,
             std::string imgname = project + string_printf("%.5d", i++) + "." +
                                   rst.extension();
 
-            zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
+            // PNG layer images carry their own deflate compression, store
+            // them as they are instead of deflating them a second time.
+            // Other encodings (the SVG layers of SL1_SVG) compress well and
+            // keep the archive wide compression level.
+            if (strcmp(rst.extension(), "png") == 0)
+                zipper.add_entry(imgname.c_str(), rst.data(), rst.size(),
+                                 Zipper::NO_COMPRESSION);
+            else
+                zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
         }
 
         for (const ThumbnailData& data : thumbnails)
@@ -138,8 +138,10 @@ class SVGRaster : public sla::RasterBase {
     sla::Resolution m_res;
     Trafo           m_trafo;
     Vec2d           m_sc;
+    double          m_tol;
 
     std::string m_svg;
+    size_t      m_header_size = 0;
 
 public:
     SVGRaster(const BoundingBox &svgarea, sla::Resolution res, Trafo tr = {})
@@ -147,6 +149,8 @@ public:
         , m_res{res}
         , m_trafo{tr}
         , m_sc{double(m_res.width_px) / m_bb.size().x(), double(m_res.height_px) / m_bb.size().y()}
+        , m_tol{std::min(m_bb.size().x() / double(m_res.width_px),
+                         m_bb.size().y() / double(m_res.height_px))}
     {
         // Inside the svg header, the boundaries will be defined in mm to
         // the actual bed size. The viewport is then defined to work with our
@@ -168,16 +172,13 @@ public:
             "<svg height=\"" + hf + "mm" + "\" width=\"" + wf + "mm" + "\" viewBox=\"0 0 " + w + " " + h +
             "\" style=\"fill: white; stroke: none; fill-rule: nonzero\" "
             "xmlns=\"http://www.w3.org/2000/svg\" xmlns:svg=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n";
+
+        m_header_size = m_svg.size();
     }
 
     void draw(const ExPolygon& poly) override
     {
-        auto cpoly = poly;
-
-        double tol = std::min(m_bb.size().x() / double(m_res.width_px),
-                              m_bb.size().y() / double(m_res.height_px));
-
-        ExPolygons cpolys = poly.simplify(tol);
+        ExPolygons cpolys = poly.simplify(m_tol);
 
         for (auto &cpoly : cpolys) {
             transform(cpoly, m_trafo, m_bb);
@@ -195,6 +196,9 @@ public:
         }
     }
 
+    // Throw away the drawn polygons, keep only the header.
+    void reset() override { m_svg.resize(m_header_size); }
+
     Trafo trafo() const override { return m_trafo; }
 
     // The encoder is ignored here, the svg text does not need any further
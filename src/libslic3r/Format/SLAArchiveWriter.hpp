@@ -6,6 +6,7 @@
 #define SLAARCHIVE_HPP
 
 #include <stddef.h>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <string>
@@ -40,15 +41,38 @@ public:
         const EP & ep       = {})
     {
         m_layers.resize(layer_num);
+
+        // Pool of rasters shared between the layers. Allocating and zeroing
+        // a full framebuffer for each layer is expensive at high resolutions,
+        // so finished rasters are recycled: the pool never grows beyond the
+        // number of concurrently processed layers.
+        std::mutex pool_mtx;
+        std::vector<std::unique_ptr<sla::RasterBase>> pool;
+
         execution::for_each(
             ep, size_t(0), m_layers.size(),
-            [this, &drawfn, &cancelfn](size_t idx) {
+            [this, &drawfn, &cancelfn, &pool_mtx, &pool](size_t idx) {
                 if (cancelfn()) return;
 
-                sla::EncodedRaster &enc = m_layers[idx];
-                auto                rst = create_raster();
+                std::unique_ptr<sla::RasterBase> rst;
+                {
+                    std::lock_guard lk{pool_mtx};
+                    if (!pool.empty()) {
+                        rst = std::move(pool.back());
+                        pool.pop_back();
+                    }
+                }
+
+                if (rst)
+                    rst->reset();
+                else
+                    rst = create_raster();
+
                 drawfn(*rst, idx);
-                enc = rst->encode(get_encoder());
+                m_layers[idx] = rst->encode(get_encoder());
+
+                std::lock_guard lk{pool_mtx};
+                pool.emplace_back(std::move(rst));
             },
             execution::max_concurrency(ep));
     }
@@ -6,6 +6,8 @@
 #include <boost/nowide/cstdio.hpp>
 #include <LocalesUtils.hpp>
 #include <fast_float.h>
+#include <algorithm>
+#include <iterator>
 #include <new>
 #include <system_error>
 #include <utility>
@@ -14,6 +16,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "libslic3r/Execution/ExecutionTBB.hpp"
+#include "libslic3r/Thread.hpp"
 #include "objparser.hpp"
 
 namespace ObjParser {
@@ -32,7 +36,18 @@ static double strtod_clocale(const char* str, char const** str_end)
 	return val;
 }
 
-static bool obj_parseline(const char *line, ObjData &data)
+// Counts of the index based vertex elements ("v", "vt", "vn") preceding a span
+// of the file. When the file is parsed in parallel chunks, relative (negative)
+// indices of the faces have to be resolved against the number of elements
+// defined by the preceding chunks in addition to the elements of the local chunk.
+struct ObjIndexBases
+{
+	int coordinates			= 0;
+	int textureCoordinates	= 0;
+	int normals				= 0;
+};
+
+static bool obj_parseline(const char *line, ObjData &data, const ObjIndexBases &bases = {})
 {
 #define EATWS() while (*line == ' ' || *line == '\t') ++ line
 
@@ -240,15 +255,15 @@ static bool obj_parseline(const char *line, ObjData &data)
 				}
 			}
 			if (vertex.coordIdx < 0)
-                vertex.coordIdx += (int)data.coordinates.size() / 4;
+                vertex.coordIdx += bases.coordinates + (int)data.coordinates.size() / 4;
             else
 				-- vertex.coordIdx;
 			if (vertex.normalIdx < 0)
-                vertex.normalIdx += (int)data.normals.size() / 3;
+                vertex.normalIdx += bases.normals + (int)data.normals.size() / 3;
             else
 				-- vertex.normalIdx;
 			if (vertex.textureCoordIdx < 0)
-                vertex.textureCoordIdx += (int)data.textureCoordinates.size() / 3;
+                vertex.textureCoordIdx += bases.textureCoordinates + (int)data.textureCoordinates.size() / 3;
             else
 				-- vertex.textureCoordIdx;
 			data.vertices.push_back(vertex);
@@ -346,54 +361,203 @@ static bool obj_parseline(const char *line, ObjData &data)
 	return true;
 }
 
-bool objparse(const char *path, ObjData &data)
+// Parse a buffer holding a complete OBJ file. The buffer is split at line
+// boundaries into roughly equal chunks and the chunks are parsed in parallel
+// into private ObjData instances, which are merged afterwards. Relative
+// (negative) indices of the face vertices are resolved against per chunk
+// element counts collected by a cheap counting pre-pass, thus no chunk has to
+// wait for the preceding chunks to be parsed.
+static bool obj_parse_in_memory(char *begin, size_t size, ObjData &data)
 {
-    Slic3r::CNumericLocalesSetter locales_setter;
+	// Lower bound on the chunk size, so that short files are not split into
+	// chunks not worth the scheduling overhead.
+	constexpr size_t min_chunk_size = 1 << 20;
+	size_t nchunks = std::min(size_t(Slic3r::execution::max_concurrency(Slic3r::ex_tbb)), size / min_chunk_size + 1);
+
+	// Split the buffer at line boundaries.
+	std::vector<size_t> bounds;
+	bounds.reserve(nchunks + 1);
+	bounds.push_back(0);
+	for (size_t i = 1; i < nchunks; ++ i) {
+		size_t pos = std::max(bounds.back(), i * (size / nchunks));
+		while (pos < size && begin[pos] != '\n' && begin[pos] != '\r')
+			++ pos;
+		while (pos < size && (begin[pos] == '\n' || begin[pos] == '\r'))
+			++ pos;
+		if (pos > bounds.back() && pos < size)
+			bounds.push_back(pos);
+	}
+	bounds.push_back(size);
+	nchunks = bounds.size() - 1;
+
+	std::vector<ObjData>		chunk_data(nchunks);
+	std::vector<ObjIndexBases>	chunk_bases(nchunks);
+
+	if (nchunks > 1)
+		// Counting pre-pass: number of vertex elements defined inside each chunk.
+		// Converted into base offsets below, to let each chunk resolve relative
+		// indices independently of the other chunks.
+		Slic3r::execution::for_each(Slic3r::ex_tbb, size_t(0), nchunks,
+			[begin, &bounds, &chunk_bases](size_t chunk_idx) {
+				ObjIndexBases &counts = chunk_bases[chunk_idx];
+				const char *p	= begin + bounds[chunk_idx];
+				const char *end	= begin + bounds[chunk_idx + 1];
+				while (p < end) {
+					while (p < end && (*p == ' ' || *p == '\t'))
+						++ p;
+					if (p + 1 < end && *p == 'v') {
+						if (p[1] == ' ' || p[1] == '\t')
+							++ counts.coordinates;
+						else if (p + 2 < end && (p[2] == ' ' || p[2] == '\t')) {
+							if (p[1] == 't')
+								++ counts.textureCoordinates;
+							else if (p[1] == 'n')
+								++ counts.normals;
+						}
+					}
+					while (p < end && *p != '\n' && *p != '\r')
+						++ p;
+					while (p < end && (*p == '\n' || *p == '\r'))
+						++ p;
+				}
+			},
+			Slic3r::execution::max_concurrency(Slic3r::ex_tbb));
 
-	FILE *pFile = boost::nowide::fopen(path, "rt");
-	if (pFile == 0)
-		return false;
+	{
+		// Exclusive prefix sum converting the per chunk counts into base offsets,
+		// starting at the number of elements already stored inside data.
+		ObjIndexBases total { int(data.coordinates.size() / 4), int(data.textureCoordinates.size() / 3), int(data.normals.size() / 3) };
+		for (ObjIndexBases &bases : chunk_bases) {
+			ObjIndexBases counts = bases;
+			bases = total;
+			total.coordinates		 += counts.coordinates;
+			total.textureCoordinates += counts.textureCoordinates;
+			total.normals			 += counts.normals;
+		}
+	}
 
-	constexpr size_t half_buf = 65536;
-	try {
-        char buf[half_buf * 2];
-		size_t len = 0;
-		size_t lenPrev = 0;
-        while ((len = ::fread(buf + lenPrev, 1, half_buf-1, pFile)) != 0) {
-            if (std::feof(pFile)) {
-                // Fix issue with missing last trinagle in obj file:
-                // https://github.com/prusa3d/PrusaSlicer/issues/12157
-                // algorithm expect line endings after last face
-                // but file format support it
-                buf[len+lenPrev] = '\n';
-                ++len;
-            }
-			len += lenPrev;
-			size_t lastLine = 0;
-			for (size_t i = 0; i < len; ++ i)
-				if (buf[i] == '\r' || buf[i] == '\n') {
-					buf[i] = 0;
-					char *c = buf + lastLine;
+	// Parse the chunks in parallel. Lines are zero terminated in place, each
+	// worker only touches the bytes of its own chunk.
+	Slic3r::execution::for_each(Slic3r::ex_tbb, size_t(0), nchunks,
+		[begin, &bounds, &chunk_data, &chunk_bases](size_t chunk_idx) {
+			ObjData &d = chunk_data[chunk_idx];
+			char *last = begin + bounds[chunk_idx];
+			char *end  = begin + bounds[chunk_idx + 1];
+			for (char *i = last; i != end; ++ i)
+				if (*i == '\r' || *i == '\n') {
+					*i = 0;
+					char *c = last;
 					while (*c == ' ' || *c == '\t')
 						++ c;
 					//FIXME check the return value and exit on error?
 					// Will it break parsing of some obj files?
-					obj_parseline(c, data);
-					lastLine = i + 1;
+					obj_parseline(c, d, chunk_bases[chunk_idx]);
+					last = i + 1;
 				}
-			lenPrev = len - lastLine;
-            if (lenPrev > half_buf) {
-		    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Excessive line length";
-				::fclose(pFile);
-				return false;
-			}
-			memmove(buf, buf + lastLine, lenPrev);
+		},
+		Slic3r::execution::max_concurrency(Slic3r::ex_tbb));
+
+	// Merge the per chunk results. Vertex element indices of the faces are
+	// already zero based global indices, only the vertexIdxFirst members
+	// referencing the merged face vertex stream have to be shifted.
+	{
+		size_t coordinates = data.coordinates.size(), textureCoordinates = data.textureCoordinates.size(), normals = data.normals.size(),
+			   parameters = data.parameters.size(), mtllibs = data.mtllibs.size(), usemtls = data.usemtls.size(), objects = data.objects.size(),
+			   groups = data.groups.size(), smoothingGroups = data.smoothingGroups.size(), vertices = data.vertices.size();
+		for (const ObjData &d : chunk_data) {
+			coordinates			+= d.coordinates.size();
+			textureCoordinates	+= d.textureCoordinates.size();
+			normals				+= d.normals.size();
+			parameters			+= d.parameters.size();
+			mtllibs				+= d.mtllibs.size();
+			usemtls				+= d.usemtls.size();
+			objects				+= d.objects.size();
+			groups				+= d.groups.size();
+			smoothingGroups		+= d.smoothingGroups.size();
+			vertices			+= d.vertices.size();
+		}
+		data.coordinates.reserve(coordinates);
+		data.textureCoordinates.reserve(textureCoordinates);
+		data.normals.reserve(normals);
+		data.parameters.reserve(parameters);
+		data.mtllibs.reserve(mtllibs);
+		data.usemtls.reserve(usemtls);
+		data.objects.reserve(objects);
+		data.groups.reserve(groups);
+		data.smoothingGroups.reserve(smoothingGroups);
+		data.vertices.reserve(vertices);
+	}
+	for (ObjData &d : chunk_data) {
+		int vertexIdxBase = int(data.vertices.size());
+		data.coordinates.insert(data.coordinates.end(), d.coordinates.begin(), d.coordinates.end());
+		data.textureCoordinates.insert(data.textureCoordinates.end(), d.textureCoordinates.begin(), d.textureCoordinates.end());
+		data.normals.insert(data.normals.end(), d.normals.begin(), d.normals.end());
+		data.parameters.insert(data.parameters.end(), d.parameters.begin(), d.parameters.end());
+		data.vertices.insert(data.vertices.end(), d.vertices.begin(), d.vertices.end());
+		data.mtllibs.insert(data.mtllibs.end(), std::make_move_iterator(d.mtllibs.begin()), std::make_move_iterator(d.mtllibs.end()));
+		for (ObjUseMtl &v : d.usemtls) {
+			v.vertexIdxFirst += vertexIdxBase;
+			data.usemtls.emplace_back(std::move(v));
+		}
+		for (ObjObject &v : d.objects) {
+			v.vertexIdxFirst += vertexIdxBase;
+			data.objects.emplace_back(std::move(v));
 		}
+		for (ObjGroup &v : d.groups) {
+			v.vertexIdxFirst += vertexIdxBase;
+			data.groups.emplace_back(std::move(v));
+		}
+		for (ObjSmoothingGroup &v : d.smoothingGroups) {
+			v.vertexIdxFirst += vertexIdxBase;
+			data.smoothingGroups.push_back(v);
+		}
+	}
+
+	return true;
+}
+
+bool objparse(const char *path, ObjData &data)
+{
+	// The chunks are parsed on TBB worker threads, the classic C locale has to
+	// be enforced on each of them, not just on the calling thread.
+	Slic3r::TBBLocalesSetter locales_setter;
+
+	// Binary mode, so that the byte count reported by ftell matches the bytes
+	// read. Carriage returns are handled by the line splitting.
+	FILE *pFile = boost::nowide::fopen(path, "rb");
+	if (pFile == 0)
+		return false;
+
+	try {
+		// Read the complete file into memory, the parsing pass splits the
+		// buffer into chunks processed in parallel.
+		::fseek(pFile, 0, SEEK_END);
+		long file_size = ::ftell(pFile);
+		if (file_size < 0) {
+			::fclose(pFile);
+			return false;
+		}
+		::rewind(pFile);
+		std::vector<char> buf(size_t(file_size));
+		if (::fread(buf.data(), 1, buf.size(), pFile) != buf.size()) {
+			::fclose(pFile);
+			return false;
+		}
+		::fclose(pFile);
+		pFile = nullptr;
+		// Fix issue with missing last triangle in obj file:
+		// https://github.com/prusa3d/PrusaSlicer/issues/12157
+		// algorithm expects line endings after last face
+		// but file format supports it
+		if (buf.empty() || (buf.back() != '\n' && buf.back() != '\r'))
+			buf.push_back('\n');
+		obj_parse_in_memory(buf.data(), buf.size(), data);
     }
     catch (std::bad_alloc&) {
     	BOOST_LOG_TRIVIAL(error) << "ObjParser: Out of memory";
+		if (pFile != nullptr)
+			::fclose(pFile);
 	}
-	::fclose(pFile);
 
 	// printf("vertices: %d\r\n", data.vertices.size() / 4);
 	// printf("coords: %d\r\n", data.coordinates.size());
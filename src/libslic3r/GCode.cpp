@@ -80,6 +80,7 @@
 #endif
 #if TBB_VERSION_MAJOR >= 2021
     #include <tbb/parallel_pipeline.h>
+    #include <tbb/task_arena.h>
     using slic3r_tbb_filtermode = tbb::filter_mode;
 #else
     #include <tbb/pipeline.h>
@@ -658,6 +659,9 @@ void GCodeGenerator::do_export(Print* print, const char* path, GCodeProcessorRes
 
     BOOST_LOG_TRIVIAL(debug) << "Start processing gcode, " << log_memory_info();
     // Post-process the G-code to update time stamps.
+    // Re-processing the binarized file only synchronizes the result moves with the final line numbering
+    // for the preview, thus skip it when the caller does not consume the result.
+    m_processor.enable_binary_preview_sync(result != nullptr);
     m_processor.finalize(true);
 //    DoExport::update_print_estimated_times_stats(m_processor, print->m_print_statistics);
     DoExport::update_print_estimated_stats(m_processor, m_writer.extruders(), print->m_print_statistics);
@@ -1275,10 +1279,18 @@ void GCodeGenerator::_do_export(Print& print, GCodeOutputStream &file, Thumbnail
     if (print.config().complete_objects.value) {
         size_t finished_objects = 0;
         const PrintObject *prev_object = (*print_object_instance_sequential_active)->print_object;
+        // The extruders collected for an object do not depend on the extruder its instance is started with,
+        // only their ordering does. Cache the collected extruders of the current object, so that further
+        // instances of the same object only redo the ordering.
+        ToolOrdering tool_ordering_collected;
         for (; print_object_instance_sequential_active != print_object_instances_ordering.end(); ++ print_object_instance_sequential_active) {
             const PrintObject &object = *(*print_object_instance_sequential_active)->print_object;
             if (&object != prev_object || tool_ordering.first_extruder() != final_extruder_id) {
-                tool_ordering = ToolOrdering(object, final_extruder_id);
+                if (&object != prev_object || tool_ordering_collected.empty())
+                    tool_ordering_collected = ToolOrdering(object);
+                tool_ordering = tool_ordering_collected;
+                if (! tool_ordering.empty())
+                    tool_ordering.reorder_and_finalize(object, final_extruder_id);
                 unsigned int new_extruder_id = tool_ordering.first_extruder();
                 if (new_extruder_id == (unsigned int)-1)
                     // Skip this object.
@@ -1532,8 +1544,11 @@ void GCodeGenerator::process_layers(
 {
     size_t layer_to_print_idx = 0;
     const GCode::SmoothPathCache::InterpolationParameters interpolation_params = interpolation_parameters(print.config());
-    const auto smooth_path_interpolator = tbb::make_filter<void, std::pair<size_t, GCode::SmoothPathCache>>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &layers_to_print, &layer_to_print_idx, &interpolation_params](tbb::flow_control &fc) -> std::pair<size_t, GCode::SmoothPathCache> {
+    // The feeder only hands out layer indices; the expensive smooth path interpolation runs in the
+    // parallel filter behind it, thus multiple layers are interpolated concurrently while the
+    // stateful generator consumes them in order.
+    const auto layer_feeder = tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &layers_to_print, &layer_to_print_idx](tbb::flow_control &fc) -> size_t {
             if (layer_to_print_idx >= layers_to_print.size()) {
                 if (layer_to_print_idx == layers_to_print.size() + (m_pressure_equalizer ? 1 : 0)) {
                     fc.stop();
@@ -1541,16 +1556,20 @@ void GCodeGenerator::process_layers(
                 } else {
                     // Pressure equalizer need insert empty input. Because it returns one layer back.
                     // Insert NOP (no operation) layer;
-                    return { layer_to_print_idx ++, {} };
+                    return layer_to_print_idx ++;
                 }
             } else {
                 print.throw_if_canceled();
-                size_t idx = layer_to_print_idx ++;
-                GCode::SmoothPathCache smooth_path_cache;
+                return layer_to_print_idx ++;
+            }
+        });
+    const auto smooth_path_interpolator = tbb::make_filter<size_t, std::pair<size_t, GCode::SmoothPathCache>>(slic3r_tbb_filtermode::parallel,
+        [&layers_to_print, &interpolation_params](size_t idx) -> std::pair<size_t, GCode::SmoothPathCache> {
+            GCode::SmoothPathCache smooth_path_cache;
+            if (idx < layers_to_print.size())
                 for (const ObjectLayerToPrint &l : layers_to_print[idx].second)
                     GCodeGenerator::smooth_path_interpolate(l, interpolation_params, smooth_path_cache);
-                return { idx, std::move(smooth_path_cache) };
-            }
+            return { idx, std::move(smooth_path_cache) };
         });
     const auto generator = tbb::make_filter<std::pair<size_t, GCode::SmoothPathCache>, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [this, &print, &tool_ordering, &print_object_instances_ordering, &layers_to_print, &smooth_path_cache_global](
@@ -1584,14 +1603,26 @@ void GCodeGenerator::process_layers(
         [pressure_equalizer = this->m_pressure_equalizer.get()](LayerResult in) -> LayerResult {
             return pressure_equalizer->process_layer(std::move(in));
         });
-    const auto cooling = tbb::make_filter<LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order,
-        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in) -> std::string {
-             if (in.nop_layer_result)
-                return in.gcode;
-
-             return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
+    // The cooling filter is split into two serial stages: the analysis (parse + slow down calculation)
+    // carries the parser position / extruder state, the rewrite carries the fan state, thus the analysis
+    // of a layer overlaps with the rewrite of the previous one.
+    const auto cooling_analysis = tbb::make_filter<LayerResult, CoolingBuffer::LayerAnalysis>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in) -> CoolingBuffer::LayerAnalysis {
+             if (in.nop_layer_result) {
+                // Pass the G-code through the rewrite stage unmodified.
+                CoolingBuffer::LayerAnalysis analysis;
+                analysis.gcode = std::move(in.gcode);
+                return analysis;
+             }
+             return cooling_buffer->analyze_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
+        });
+    const auto cooling_apply = tbb::make_filter<CoolingBuffer::LayerAnalysis, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](CoolingBuffer::LayerAnalysis analysis) -> std::string {
+             return cooling_buffer->apply_layer_cooldown(std::move(analysis));
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // Find / replace works on one layer string at a time without carrying state across layers,
+    // thus it may run in parallel; the downstream serial output filter restores token order.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
@@ -1599,13 +1630,13 @@ void GCodeGenerator::process_layers(
         [&output_stream](std::string s) { output_stream.write(s); }
     );
 
-    tbb::filter<void, LayerResult> pipeline_to_layerresult = smooth_path_interpolator & generator;
+    tbb::filter<void, LayerResult> pipeline_to_layerresult = layer_feeder & smooth_path_interpolator & generator;
     if (m_spiral_vase)
         pipeline_to_layerresult = pipeline_to_layerresult & spiral_vase;
     if (m_pressure_equalizer)
         pipeline_to_layerresult = pipeline_to_layerresult & pressure_equalizer;
 
-    tbb::filter<LayerResult, std::string> pipeline_to_string = cooling;
+    tbb::filter<LayerResult, std::string> pipeline_to_string = cooling_analysis & cooling_apply;
     if (m_find_replace)
         pipeline_to_string = pipeline_to_string & find_replace;
 
@@ -1614,7 +1645,9 @@ void GCodeGenerator::process_layers(
     TBBLocalesSetter locales_setter;
     // The pipeline elements are joined using const references, thus no copying is performed.
     output_stream.find_replace_supress();
-    tbb::parallel_pipeline(12, pipeline_to_layerresult & pipeline_to_string & output);
+    // Keep enough tokens in flight to feed the parallel interpolation and find / replace stages
+    // on wide machines; the serial stages bound the speedup, the extra tokens only buffer them.
+    tbb::parallel_pipeline(std::max(size_t(12), size_t(2) * tbb::this_task_arena::max_concurrency()), pipeline_to_layerresult & pipeline_to_string & output);
     output_stream.find_replace_enable();
 }
 
@@ -1631,8 +1664,9 @@ void GCodeGenerator::process_layers(
 {
     size_t layer_to_print_idx = 0;
     const GCode::SmoothPathCache::InterpolationParameters interpolation_params = interpolation_parameters(print.config());
-    const auto smooth_path_interpolator = tbb::make_filter<void, std::pair<size_t, GCode::SmoothPathCache>> (slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &layers_to_print, &layer_to_print_idx, interpolation_params](tbb::flow_control &fc) -> std::pair<size_t, GCode::SmoothPathCache> {
+    // See the multi-object process_layers() above: serial index feeder, parallel interpolation.
+    const auto layer_feeder = tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &layers_to_print, &layer_to_print_idx](tbb::flow_control &fc) -> size_t {
             if (layer_to_print_idx >= layers_to_print.size()) {
                 if (layer_to_print_idx == layers_to_print.size() + (m_pressure_equalizer ? 1 : 0)) {
                     fc.stop();
@@ -1640,16 +1674,20 @@ void GCodeGenerator::process_layers(
                 } else {
                     // Pressure equalizer need insert empty input. Because it returns one layer back.
                     // Insert NOP (no operation) layer;
-                    return { layer_to_print_idx ++, {} };
+                    return layer_to_print_idx ++;
                 }
             } else {
                 print.throw_if_canceled();
-                size_t idx = layer_to_print_idx ++;
-                GCode::SmoothPathCache smooth_path_cache;
-                GCodeGenerator::smooth_path_interpolate(layers_to_print[idx], interpolation_params, smooth_path_cache);
-                return { idx, std::move(smooth_path_cache) };
+                return layer_to_print_idx ++;
             }
         });
+    const auto smooth_path_interpolator = tbb::make_filter<size_t, std::pair<size_t, GCode::SmoothPathCache>>(slic3r_tbb_filtermode::parallel,
+        [&layers_to_print, interpolation_params](size_t idx) -> std::pair<size_t, GCode::SmoothPathCache> {
+            GCode::SmoothPathCache smooth_path_cache;
+            if (idx < layers_to_print.size())
+                GCodeGenerator::smooth_path_interpolate(layers_to_print[idx], interpolation_params, smooth_path_cache);
+            return { idx, std::move(smooth_path_cache) };
+        });
     const auto generator = tbb::make_filter<std::pair<size_t, GCode::SmoothPathCache>, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [this, &print, &tool_ordering, &layers_to_print, &smooth_path_cache_global, single_object_idx](std::pair<size_t, GCode::SmoothPathCache> in) -> LayerResult {
             size_t layer_to_print_idx = in.first;
@@ -1678,13 +1716,24 @@ void GCodeGenerator::process_layers(
         [pressure_equalizer = this->m_pressure_equalizer.get()](LayerResult in) -> LayerResult {
              return pressure_equalizer->process_layer(std::move(in));
         });
-    const auto cooling = tbb::make_filter<LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order,
-        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in)->std::string {
-            if (in.nop_layer_result)
-                return in.gcode;
-            return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
+    // See the multi-object process_layers() above: the analysis of a layer overlaps with the rewrite
+    // of the previous one.
+    const auto cooling_analysis = tbb::make_filter<LayerResult, CoolingBuffer::LayerAnalysis>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in) -> CoolingBuffer::LayerAnalysis {
+            if (in.nop_layer_result) {
+                // Pass the G-code through the rewrite stage unmodified.
+                CoolingBuffer::LayerAnalysis analysis;
+                analysis.gcode = std::move(in.gcode);
+                return analysis;
+            }
+            return cooling_buffer->analyze_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
+        });
+    const auto cooling_apply = tbb::make_filter<CoolingBuffer::LayerAnalysis, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](CoolingBuffer::LayerAnalysis analysis) -> std::string {
+            return cooling_buffer->apply_layer_cooldown(std::move(analysis));
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // See the multi-object process_layers() above: stateless per-layer filter, runs in parallel.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
@@ -1692,13 +1741,13 @@ void GCodeGenerator::process_layers(
         [&output_stream](std::string s) { output_stream.write(s); }
     );
 
-    tbb::filter<void, LayerResult> pipeline_to_layerresult = smooth_path_interpolator & generator;
+    tbb::filter<void, LayerResult> pipeline_to_layerresult = layer_feeder & smooth_path_interpolator & generator;
     if (m_spiral_vase)
         pipeline_to_layerresult = pipeline_to_layerresult & spiral_vase;
     if (m_pressure_equalizer)
         pipeline_to_layerresult = pipeline_to_layerresult & pressure_equalizer;
 
-    tbb::filter<LayerResult, std::string> pipeline_to_string = cooling;
+    tbb::filter<LayerResult, std::string> pipeline_to_string = cooling_analysis & cooling_apply;
     if (m_find_replace)
         pipeline_to_string = pipeline_to_string & find_replace;
 
@@ -1707,7 +1756,7 @@ void GCodeGenerator::process_layers(
     TBBLocalesSetter locales_setter;
     // The pipeline elements are joined using const references, thus no copying is performed.
     output_stream.find_replace_supress();
-    tbb::parallel_pipeline(12, pipeline_to_layerresult & pipeline_to_string & output);
+    tbb::parallel_pipeline(std::max(size_t(12), size_t(2) * tbb::this_task_arena::max_concurrency()), pipeline_to_layerresult & pipeline_to_string & output);
     output_stream.find_replace_enable();
 }
 
@@ -3543,7 +3592,7 @@ std::string GCodeGenerator::_extrude(
     }
 
     // F is mm per minute.
-    gcode += m_writer.set_speed(F, "", cooling_marker_setspeed_comments);
+    m_writer.set_speed(gcode, F, "", cooling_marker_setspeed_comments);
 
     if (dynamic_print_and_fan_speeds.fan_speed >= 0) {
         const int fan_speed = int(dynamic_print_and_fan_speeds.fan_speed);
@@ -3593,9 +3642,9 @@ std::string GCodeGenerator::_extrude(
                     double extrusion_amount{e_per_mm * line_length * it->e_fraction};
                     if (it->height_fraction < 1.0 || std::prev(it)->height_fraction < 1.0) {
                         const Vec3d destination{to_3d(p, this->m_last_layer_z + (it->height_fraction - 1) * m_last_height)};
-                        gcode += m_writer.extrude_to_xyz(destination, extrusion_amount);
+                        m_writer.extrude_to_xyz(gcode, destination, extrusion_amount);
                     } else {
-                        gcode += m_writer.extrude_to_xy(p, extrusion_amount, comment);
+                        m_writer.extrude_to_xy(gcode, p, extrusion_amount, comment);
                     }
                 }
             } else {
@@ -3604,7 +3653,7 @@ std::string GCodeGenerator::_extrude(
                 const double line_length = angle * std::abs(radius);
                 const double dE          = e_per_mm * line_length;
                 assert(dE > 0);
-                gcode += m_writer.extrude_to_xy_G2G3IJ(p, ij, it->ccw(), dE, comment);
+                m_writer.extrude_to_xy_G2G3IJ(gcode, p, ij, it->ccw(), dE, comment);
             }
             prev = p;
             prev_exact = p_exact;
@@ -3,6 +3,9 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 #include <boost/range/adaptor/reversed.hpp>
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_invoke.h>
 #include <boost/container_hash/hash.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
 #include <unordered_set>
@@ -1167,8 +1170,11 @@ static Polygons get_boundary_external(const Layer &layer)
 static void init_boundary_distances(AvoidCrossingPerimeters::Boundary *boundary)
 {
     boundary->boundaries_params.assign(boundary->boundaries.size(), std::vector<float>());
-    for (size_t poly_idx = 0; poly_idx < boundary->boundaries.size(); ++poly_idx)
-        precompute_polygon_distances(boundary->boundaries[poly_idx], boundary->boundaries_params[poly_idx]);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, boundary->boundaries.size()),
+        [boundary](const tbb::blocked_range<size_t> &range) -> void {
+        for (size_t poly_idx = range.begin(); poly_idx < range.end(); ++poly_idx)
+            precompute_polygon_distances(boundary->boundaries[poly_idx], boundary->boundaries_params[poly_idx]);
+    });
 }
 
 static void init_boundary(AvoidCrossingPerimeters::Boundary *boundary, Polygons &&boundary_polygons)
@@ -1180,9 +1186,13 @@ static void init_boundary(AvoidCrossingPerimeters::Boundary *boundary, Polygons
     bbox.offset(SCALED_EPSILON);
     boundary->bbox = BoundingBoxf(bbox.min.cast<double>(), bbox.max.cast<double>());
     boundary->grid.set_bbox(bbox);
-    // FIXME 1mm grid?
-    boundary->grid.create(boundary->boundaries, coord_t(scale_(1.)));
-    init_boundary_distances(boundary);
+    // The lazily initialized boundaries are built on the serial G-code emission path by the first
+    // travel of a layer that needs them. The edge grid and the boundary distance parameters both just
+    // read the boundaries, so build them concurrently to shorten that stall.
+    tbb::parallel_invoke(
+        // FIXME 1mm grid?
+        [&boundary]() { boundary->grid.create(boundary->boundaries, coord_t(scale_(1.))); },
+        [&boundary]() { init_boundary_distances(boundary); });
 }
 
 // Plan travel, which avoids perimeter crossings by following the boundaries of the layer.
@@ -1269,15 +1279,19 @@ void AvoidCrossingPerimeters::init_layer(const Layer &layer)
     float perimeter_offset = -get_external_perimeter_width(layer) / float(2.);
     m_lslices_offset        = offset_ex(layer.lslices, perimeter_offset);
 
-    m_lslices_offset_bboxes.reserve(m_lslices_offset.size());
-    for (const ExPolygon &ex_poly : m_lslices_offset)
-        m_lslices_offset_bboxes.emplace_back(get_extents(ex_poly));
-
     BoundingBox bbox_slice(get_extents(layer.lslices));
     bbox_slice.offset(SCALED_EPSILON);
-
     m_grid_lslices_offset.set_bbox(bbox_slice);
-    m_grid_lslices_offset.create(m_lslices_offset, coord_t(scale_(1.)));
+
+    // Both jobs only read m_lslices_offset, run them concurrently, init_layer() is called on the
+    // serial G-code emission path before each layer.
+    tbb::parallel_invoke(
+        [this]() {
+            m_lslices_offset_bboxes.reserve(m_lslices_offset.size());
+            for (const ExPolygon &ex_poly : m_lslices_offset)
+                m_lslices_offset_bboxes.emplace_back(get_extents(ex_poly));
+        },
+        [this]() { m_grid_lslices_offset.create(m_lslices_offset, coord_t(scale_(1.))); });
 }
 
 #if 0
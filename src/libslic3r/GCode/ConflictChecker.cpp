@@ -17,6 +17,7 @@
 #include <cfloat>
 #include <cstdlib>
 
+#include "libslic3r/BoundingBox.hpp"
 #include "libslic3r/ExtrusionEntityCollection.hpp"
 #include "libslic3r/GCode/WipeTower.hpp"
 #include "libslic3r/Geometry.hpp"
@@ -283,6 +284,38 @@ std::pair<std::vector<ExtrusionPaths>, std::vector<ExtrusionPaths>> getAllLayers
     return {std::move(objPaths), std::move(supportPaths)};
 }
 
+// Broad phase of the conflict search: A conflict may only happen between lines of two different
+// object instances, thus drop the lines of all instances whose bounding box at this height does
+// not overlap the bounding box of any other instance (or of the wipe tower). On a plate of spread
+// out objects this discards most of the lines before they reach the rasterization
+// of find_inter_of_lines().
+static void prune_non_overlapping_instances(LineWithIDs &lines)
+{
+    struct InstanceBBox {
+        BoundingBox bbox;
+        bool        overlapping { false };
+    };
+    // Instances are identified by the pair of (object id, instance id).
+    std::map<std::pair<int, int>, InstanceBBox> instances;
+    for (const LineWithID &line : lines) {
+        BoundingBox &bbox = instances[{ line._obj_id, line._inst_id }].bbox;
+        bbox.merge(line._line.a);
+        bbox.merge(line._line.b);
+    }
+    if (instances.size() < 2) {
+        // Lines of a single instance cannot conflict with themselves.
+        lines.clear();
+        return;
+    }
+    for (auto it1 = instances.begin(); it1 != instances.end(); ++ it1)
+        for (auto it2 = std::next(it1); it2 != instances.end(); ++ it2)
+            if (it1->second.bbox.overlap(it2->second.bbox))
+                it1->second.overlapping = it2->second.overlapping = true;
+    lines.erase(std::remove_if(lines.begin(), lines.end(),
+                    [&instances](const LineWithID &line) { return ! instances[{ line._obj_id, line._inst_id }].overlapping; }),
+                lines.end());
+}
+
 ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines)
 {
     using namespace RasterizationImpl;
@@ -341,8 +374,11 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(SpanOfConstP
     while (conflictQueue.valid()) {
         LineWithIDs lines     = conflictQueue.getCurLines();
         double      curHeight = conflictQueue.removeLowests();
-        heights.push_back(curHeight);
-        layersLines.push_back(std::move(lines));
+        prune_non_overlapping_instances(lines);
+        if (! lines.empty()) {
+            heights.push_back(curHeight);
+            layersLines.push_back(std::move(lines));
+        }
     }
 
     bool                                   find = false;
@@ -340,7 +340,13 @@ finished:
 	return new_feedrate;
 }
 
-std::string CoolingBuffer::process_layer(std::string &&gcode, size_t layer_id, bool flush)
+// Out of line to keep PerExtruderAdjustments an incomplete type in the header.
+CoolingBuffer::LayerAnalysis::LayerAnalysis() = default;
+CoolingBuffer::LayerAnalysis::LayerAnalysis(LayerAnalysis &&) = default;
+CoolingBuffer::LayerAnalysis& CoolingBuffer::LayerAnalysis::operator=(LayerAnalysis &&) = default;
+CoolingBuffer::LayerAnalysis::~LayerAnalysis() = default;
+
+CoolingBuffer::LayerAnalysis CoolingBuffer::analyze_layer(std::string &&gcode, size_t layer_id, bool flush)
 {
     // Cache the input G-code.
     if (m_gcode.empty())
@@ -348,21 +354,31 @@ std::string CoolingBuffer::process_layer(std::string &&gcode, size_t layer_id, b
     else
         m_gcode += gcode;
 
-    std::string out;
+    LayerAnalysis analysis;
+    analysis.layer_id = layer_id;
     if (flush) {
         // This is either an object layer or the very last print layer. Calculate cool down over the collected support layers
         // and one object layer.
-        std::vector<PerExtruderAdjustments> per_extruder_adjustments = this->parse_layer_gcode(m_gcode, m_current_pos);
-        float layer_time_stretched = this->calculate_layer_slowdown(per_extruder_adjustments);
-        out = this->apply_layer_cooldown(m_gcode, layer_id, layer_time_stretched, per_extruder_adjustments);
+        analysis.per_extruder_adjustments = this->parse_layer_gcode(m_gcode, m_current_pos, m_analysis_extruder);
+        analysis.layer_time = this->calculate_layer_slowdown(analysis.per_extruder_adjustments);
+        analysis.gcode   = std::move(m_gcode);
+        analysis.flushed = true;
         m_gcode.clear();
     }
-    return out;
+    return analysis;
+}
+
+std::string CoolingBuffer::apply_layer_cooldown(LayerAnalysis &&analysis)
+{
+    return analysis.flushed ?
+        this->apply_layer_cooldown(analysis.gcode, analysis.layer_id, analysis.layer_time, analysis.per_extruder_adjustments) :
+        // The cooling buffer was not flushed, the G-code snippet (if any) is passed through unmodified.
+        std::move(analysis.gcode);
 }
 
 // Parse the layer G-code for the moves, which could be adjusted.
 // Return the list of parsed lines, bucketed by an extruder.
-std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::string &gcode, std::array<float, 5> &current_pos) const
+std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::string &gcode, std::array<float, 5> &current_pos, unsigned int &current_extruder) const
 {
     std::vector<PerExtruderAdjustments> per_extruder_adjustments(m_extruder_ids.size());
     std::vector<size_t>                 map_extruder_to_per_extruder_adjustment(m_num_extruders, 0);
@@ -376,7 +392,6 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
         map_extruder_to_per_extruder_adjustment[extruder_id] = i;
     }
 
-    unsigned int      current_extruder  = m_current_extruder;
     PerExtruderAdjustments *adjustment  = &per_extruder_adjustments[map_extruder_to_per_extruder_adjustment[current_extruder]];
     const char       *line_start = gcode.c_str();
     const char       *line_end   = line_start;
@@ -41,14 +41,43 @@ class CoolingBuffer {
 public:
     CoolingBuffer(GCodeGenerator &gcodegen);
     void        reset(const Vec3d &position);
-    void        set_current_extruder(unsigned int extruder_id) { m_current_extruder = extruder_id; }
-    std::string process_layer(std::string &&gcode, size_t layer_id, bool flush);
+    void        set_current_extruder(unsigned int extruder_id) { m_current_extruder = m_analysis_extruder = extruder_id; }
+    std::string process_layer(std::string &&gcode, size_t layer_id, bool flush)
+        { return this->apply_layer_cooldown(this->analyze_layer(std::move(gcode), layer_id, flush)); }
     std::string process_layer(const std::string &gcode, size_t layer_id, bool flush)
         { return this->process_layer(std::string(gcode), layer_id, flush); }
 
+    // Result of the analysis stage of the cooling filter: the buffered layer G-code together
+    // with its parsed cool down attributes, to be consumed by apply_layer_cooldown().
+    struct LayerAnalysis
+    {
+        LayerAnalysis();
+        LayerAnalysis(LayerAnalysis &&);
+        LayerAnalysis& operator=(LayerAnalysis &&);
+        ~LayerAnalysis();
+
+        // Buffered G-code, empty until the cooling buffer was flushed,
+        // or a snippet to be passed through unmodified if not flushed.
+        std::string                         gcode;
+        size_t                              layer_id { 0 };
+        // Total time of this layer after slow down, used to control the fan.
+        float                               layer_time { 0.f };
+        std::vector<PerExtruderAdjustments> per_extruder_adjustments;
+        // Was the cooling buffer flushed into this analysis? If not, gcode is emitted unmodified.
+        bool                                flushed { false };
+    };
+    // Analysis stage: Buffer the layer G-code, on flush parse it and calculate the slow down.
+    // Carries the position & extruder state of the parser, which is separate from the fan state
+    // consumed by apply_layer_cooldown(), so that the two stages may run as two filters
+    // of the G-code generator pipeline, overlapping the analysis of a layer
+    // with the rewrite of the previous one.
+    LayerAnalysis analyze_layer(std::string &&gcode, size_t layer_id, bool flush);
+    // Rewrite stage: Apply slow down over G-code lines of the analyzed layer, enable fan if needed.
+    std::string   apply_layer_cooldown(LayerAnalysis &&analysis);
+
 private:
 	CoolingBuffer& operator=(const CoolingBuffer&) = delete;
-    std::vector<PerExtruderAdjustments> parse_layer_gcode(const std::string &gcode, std::array<float, 5> &current_pos) const;
+    std::vector<PerExtruderAdjustments> parse_layer_gcode(const std::string &gcode, std::array<float, 5> &current_pos, unsigned int &current_extruder) const;
     float       calculate_layer_slowdown(std::vector<PerExtruderAdjustments> &per_extruder_adjustments);
     // Apply slow down over G-code lines stored in per_extruder_adjustments, enable fan if needed.
     // Returns the adjusted G-code.
@@ -73,7 +102,11 @@ private:
     // Referencs GCodeGenerator::m_config, which is FullPrintConfig. While the PrintObjectConfig slice of FullPrintConfig is being modified,
     // the PrintConfig slice of FullPrintConfig is constant, thus no thread synchronization is required.
     const PrintConfig          &m_config;
+    // Extruder tracked by the rewrite stage (apply_layer_cooldown()).
     unsigned int                m_current_extruder;
+    // Extruder tracked by the analysis stage (parse_layer_gcode()), which may run
+    // one layer ahead of the rewrite stage.
+    unsigned int                m_analysis_extruder { 0 };
 
     // Old logic: proportional.
     bool                        m_cooling_logic_proportional = false;
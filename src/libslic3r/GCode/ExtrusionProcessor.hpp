@@ -120,8 +120,12 @@ std::vector<ExtendedPoint> estimate_points_properties(
     }
     for (size_t i = 1; i < input_points.size(); i++) {
         ExtendedPoint next_point{unscaled(input_points[i])};
+        // The distance at the previous sample plus the sampling step bounds the distance at this
+        // sample (triangle inequality), letting the tree query prune most of its traversal.
+        const auto distance_hint = std::abs(points.back().distance - boundary_offset) +
+                                   (next_point.position - points.back().position).norm();
         auto [distance, nearest_line,
-              x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(next_point.position.cast<AABBScalar>());
+              x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(next_point.position.cast<AABBScalar>(), distance_hint);
         next_point.distance = distance + boundary_offset;
 
         if (((points.back().distance > boundary_offset + EPSILON) != (next_point.distance > boundary_offset + EPSILON))) {
@@ -193,8 +197,9 @@ std::vector<ExtendedPoint> estimate_points_properties(
                 size_t new_point_count = 1.0 / t;
                 for (size_t j = 1; j < new_point_count + 1; j++) {
                     Vec2d pos  = curr.position * (1.0 - j * t) + next.position * (j * t);
+                    const auto distance_hint = std::abs(curr.distance - boundary_offset) + (pos - curr.position).norm();
                     auto [p_dist, p_near_l,
-                          p_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(pos.cast<AABBScalar>());
+                          p_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(pos.cast<AABBScalar>(), distance_hint);
                     ExtendedPoint new_p{};
                     new_p.position = pos;
                     new_p.distance = float(p_dist + boundary_offset);
@@ -7,8 +7,10 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/find.hpp>
 #include <boost/range/iterator_range_core.hpp>
+#include <algorithm>
 #include <cctype> // isalpha
 #include <exception>
+#include <functional> // boyer_moore_horspool_searcher
 #include <iterator>
 #include <tuple>
 #include <utility>
@@ -130,14 +132,22 @@ std::string GCodeFindReplace::process_layer(const std::string &ain)
             temp.clear();
             temp.reserve(in->size());
             boost::regex_replace(ToStringIterator(temp), in->begin(), in->end(),
-                substitution.regexp_pattern, substitution.format, 
+                substitution.regexp_pattern, substitution.format,
                 (substitution.single_line ? boost::match_single_line | boost::match_default : boost::match_not_dot_newline | boost::match_default) | boost::format_all);
             std::swap(out, temp);
-        } else {
-            if (in == &ain)
-                out = ain;
-            // Plain substitution
+        } else if (! substitution.plain_pattern.empty()) {
+            // Plain substitution. Most patterns are absent from a typical layer, thus the buffer
+            // is scanned for the first occurrence before anything is copied or rewritten and
+            // left untouched if there is no match.
             if (substitution.case_insensitive) {
+                {
+                    boost::iterator_range<std::string::const_iterator> r1(in->begin(), in->end());
+                    boost::iterator_range<std::string::const_iterator> r2(substitution.plain_pattern.begin(), substitution.plain_pattern.end());
+                    if (! boost::ifind_first(r1, r2))
+                        continue;
+                }
+                if (in == &ain)
+                    out = ain;
                 if (substitution.whole_word)
                     find_and_replace_whole_word(out, substitution.plain_pattern, substitution.format,
                         [](const std::string &str, size_t start_pos, const std::string &match) {
@@ -150,20 +160,43 @@ std::string GCodeFindReplace::process_layer(const std::string &ain)
                 else
                     boost::ireplace_all(out, substitution.plain_pattern, substitution.format);
             } else {
-                if (substitution.whole_word)
+                // Case sensitive patterns are located with the Boyer-Moore-Horspool algorithm,
+                // which skips over up to pattern-length characters per mismatch.
+                const std::boyer_moore_horspool_searcher searcher(
+                    substitution.plain_pattern.begin(), substitution.plain_pattern.end());
+                auto first = std::search(in->begin(), in->end(), searcher);
+                if (first == in->end())
+                    continue;
+                if (substitution.whole_word) {
+                    if (in == &ain)
+                        out = ain;
                     find_and_replace_whole_word(out, substitution.plain_pattern, substitution.format,
-                        [](const std::string &str, size_t start_pos, const std::string &match) { 
-                            size_t pos = str.find(match, start_pos);
+                        [&searcher](const std::string &str, size_t start_pos, const std::string &match) {
+                            auto it = std::search(str.begin() + start_pos, str.end(), searcher);
+                            size_t pos = it == str.end() ? std::string::npos : size_t(it - str.begin());
                             return std::make_pair(pos, pos + (pos == std::string::npos ? 0 : match.size()));
                         });
-                else
-                    boost::replace_all(out, substitution.plain_pattern, substitution.format);
+                } else {
+                    // Replace all occurrences, reusing the already located first one.
+                    temp.clear();
+                    temp.reserve(in->size());
+                    auto pos = in->begin();
+                    for (auto it = first;; it = std::search(pos, in->end(), searcher)) {
+                        temp.append(pos, it);
+                        if (it == in->end())
+                            break;
+                        temp.append(substitution.format);
+                        pos = it + substitution.plain_pattern.size();
+                    }
+                    std::swap(out, temp);
+                }
             }
-        }
+        } else
+            continue;
         in = &out;
     }
 
-    return out;
+    return in == &ain ? ain : out;
 }
 
 }
@@ -21,6 +21,8 @@
 #include <boost/nowide/cstdio.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include <tbb/parallel_for.h>
+
 #include <float.h>
 #include <assert.h>
 
@@ -3712,6 +3714,11 @@ void GCodeProcessor::post_process()
     if (out.f == nullptr)
         throw Slic3r::RuntimeError(std::string("GCode processor post process export failed.\nCannot open file for writing.\n"));
 
+    // Post processing streams the whole G-code file through. Large stdio buffers amortize the cost of the many
+    // small fwrite() calls issued while flushing the export cache on multi hundred MB files.
+    ::setvbuf(in.f, nullptr, _IOFBF, 1024 * 1024);
+    ::setvbuf(out.f, nullptr, _IOFBF, 1024 * 1024);
+
     std::vector<double> filament_mm(m_result.extruders_count, 0.0);
     std::vector<double> filament_cm3(m_result.extruders_count, 0.0);
     std::vector<double> filament_g(m_result.extruders_count, 0.0);
@@ -4024,6 +4031,7 @@ void GCodeProcessor::post_process()
 
             // collect lines to write into a single string
             std::string out_string;
+            out_string.reserve(m_size);
             if (!m_lines.empty()) {
                 if (m_write_type == EWriteType::ByTime) {
                     while (m_lines.front().times[Normal] < m_times[Normal] - backtrace_time) {
@@ -4050,6 +4058,10 @@ void GCodeProcessor::post_process()
                 }
             }
 
+            // nothing reached the flush threshold, do not bother the binarizer / the output file
+            if (out_string.empty())
+                return;
+
             if (m_binarizer.is_enabled()) {
                 if (m_binarizer.append_gcode(out_string) != bgcode::core::EResult::Success)
                     throw Slic3r::RuntimeError("Error while sending gcode to the binarizer.");
@@ -4064,6 +4076,7 @@ void GCodeProcessor::post_process()
         void flush(FilePtr& out, GCodeProcessorResult& result, const std::string& out_path) {
             // collect lines to flush into a single string
             std::string out_string;
+            out_string.reserve(m_size);
             while (!m_lines.empty()) {
                 out_string += m_lines.front().line;
                 m_lines.pop_front();
@@ -4436,14 +4449,16 @@ void GCodeProcessor::post_process()
 
     const std::string result_filename = m_result.filename;
     if (m_binarizer.is_enabled()) {
-        // The list of lines in the binary gcode is different from the original one.
-        // This requires to re-process the binarized file to be able to synchronize with it all the data needed by the preview,
-        // as gcode window, tool position and moves slider which relies on indexing the gcode lines.
-        reset();
-        // the following call modifies m_result.filename
-        process_binary_file(out_path);
-        // restore the proper filename
-        m_result.filename = result_filename;
+        if (m_binary_preview_sync_enabled) {
+            // The list of lines in the binary gcode is different from the original one.
+            // This requires to re-process the binarized file to be able to synchronize with it all the data needed by the preview,
+            // as gcode window, tool position and moves slider which relies on indexing the gcode lines.
+            reset();
+            // the following call modifies m_result.filename
+            process_binary_file(out_path);
+            // restore the proper filename
+            m_result.filename = result_filename;
+        }
     }
     else
         export_lines.synchronize_moves(m_result);
@@ -4648,13 +4663,14 @@ void GCodeProcessor::process_filaments(CustomGCode::Type code)
 void GCodeProcessor::calculate_time(GCodeProcessorResult& result, size_t keep_last_n_blocks, float additional_time)
 {
     // calculate times
-    std::vector<TimeMachine::ActualSpeedMove> actual_speed_moves;
-    for (size_t i = 0; i < static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count); ++i) {
-        TimeMachine& machine = m_time_processor.machines[i];
-        machine.calculate_time(m_result, static_cast<PrintEstimatedStatistics::ETimeMode>(i), keep_last_n_blocks, additional_time);
-        if (static_cast<PrintEstimatedStatistics::ETimeMode>(i) == PrintEstimatedStatistics::ETimeMode::Normal)
-            actual_speed_moves = std::move(machine.actual_speed_moves);
-    }
+    // Each machine plans its own block queue and writes its own slot of MoveVertex::time,
+    // thus the normal and stealth estimates may be refreshed in parallel.
+    tbb::parallel_for(size_t(0), static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count),
+        [this, keep_last_n_blocks, additional_time](size_t i) {
+            m_time_processor.machines[i].calculate_time(m_result, static_cast<PrintEstimatedStatistics::ETimeMode>(i), keep_last_n_blocks, additional_time);
+        });
+    std::vector<TimeMachine::ActualSpeedMove> actual_speed_moves =
+        std::move(m_time_processor.machines[static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Normal)].actual_speed_moves);
 
     // insert actual speed moves into the move list. We will do this in two stages (to avoid inserting in the middle of
     // result.moves repeatedly). First, we create individual vectors of MoveVertices, and store them along with their
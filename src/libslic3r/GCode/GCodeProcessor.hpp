@@ -485,6 +485,8 @@ namespace Slic3r {
         GCodeReader m_parser;
         bgcode::binarize::Binarizer m_binarizer;
         static bgcode::binarize::BinarizerConfig s_binarizer_config;
+        // See enable_binary_preview_sync().
+        bool m_binary_preview_sync_enabled{ true };
 
         EUnits m_units;
         EPositioningType m_global_positioning_type;
@@ -580,6 +582,10 @@ namespace Slic3r {
             return m_time_processor.machines[static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Stealth)].enabled;
         }
         void enable_machine_envelope_processing(bool enabled) { m_time_processor.machine_envelope_processing_enabled = enabled; }
+        // When disabled, post processing of a binary G-code skips re-processing the binarized file,
+        // which is only needed to synchronize the result moves with the final line numbering for the preview.
+        // Disabled for exports whose caller does not consume the result (command line slicing).
+        void enable_binary_preview_sync(bool enabled) { m_binary_preview_sync_enabled = enabled; }
         void reset();
 
         const GCodeProcessorResult& get_result() const { return m_result; }
@@ -284,6 +284,13 @@ std::string GCodeWriter::toolchange(unsigned int extruder_id)
 }
 
 std::string GCodeWriter::set_speed(double F, const std::string_view comment, const std::string_view cooling_marker) const
+{
+    std::string gcode;
+    this->set_speed(gcode, F, comment, cooling_marker);
+    return gcode;
+}
+
+void GCodeWriter::set_speed(std::string &gcode, double F, const std::string_view comment, const std::string_view cooling_marker) const
 {
     assert(F > 0.);
     assert(F < 100000.);
@@ -292,7 +299,7 @@ std::string GCodeWriter::set_speed(double F, const std::string_view comment, con
     w.emit_f(F);
     w.emit_comment(this->config.gcode_comments, comment);
     w.emit_string(cooling_marker);
-    return w.string();
+    w.string_to(gcode);
 }
 
 std::string GCodeWriter::travel_to_xy_force(const Vec2d &point, const std::string_view comment)
@@ -403,6 +410,13 @@ std::string GCodeWriter::travel_to_z_force(double z, const std::string_view comm
 }
 
 std::string GCodeWriter::extrude_to_xy(const Vec2d &point, double dE, const std::string_view comment)
+{
+    std::string gcode;
+    this->extrude_to_xy(gcode, point, dE, comment);
+    return gcode;
+}
+
+void GCodeWriter::extrude_to_xy(std::string &gcode, const Vec2d &point, double dE, const std::string_view comment)
 {
     //assert(dE != 0);
     assert(std::abs(dE) < 1000.0);
@@ -413,10 +427,17 @@ std::string GCodeWriter::extrude_to_xy(const Vec2d &point, double dE, const std:
     w.emit_xy(point);
     w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.string_to(gcode);
 }
 
 std::string GCodeWriter::extrude_to_xyz(const Vec3d &point, double dE, const std::string_view comment)
+{
+    std::string gcode;
+    this->extrude_to_xyz(gcode, point, dE, comment);
+    return gcode;
+}
+
+void GCodeWriter::extrude_to_xyz(std::string &gcode, const Vec3d &point, double dE, const std::string_view comment)
 {
     m_pos = point;
 
@@ -424,10 +445,17 @@ std::string GCodeWriter::extrude_to_xyz(const Vec3d &point, double dE, const std
     w.emit_xyz(point);
     w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.string_to(gcode);
 }
 
 std::string GCodeWriter::extrude_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment)
+{
+    std::string gcode;
+    this->extrude_to_xy_G2G3IJ(gcode, point, ij, ccw, dE, comment);
+    return gcode;
+}
+
+void GCodeWriter::extrude_to_xy_G2G3IJ(std::string &gcode, const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment)
 {
     assert(std::abs(dE) < 1000.0);
     assert(dE != 0);
@@ -444,7 +472,7 @@ std::string GCodeWriter::extrude_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &i
     w.emit_ij(ij);
     w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.string_to(gcode);
 }
 
 #if 0
@@ -73,6 +73,8 @@ public:
     std::string toolchange_prefix() const;
     std::string toolchange(unsigned int extruder_id);
     std::string set_speed(double F, const std::string_view comment = {}, const std::string_view cooling_marker = {}) const;
+    // Variant of set_speed() appending to the target string, to avoid a temporary allocation per command.
+    void        set_speed(std::string &gcode, double F, const std::string_view comment = {}, const std::string_view cooling_marker = {}) const;
 
     /**
      * @brief Return gcode to travel to the specified point.
@@ -111,6 +113,11 @@ public:
      */
     std::string extrude_to_xy(const Vec2d &point, double dE, const std::string_view comment = {});
     std::string extrude_to_xyz(const Vec3d &point, double dE, const std::string_view comment = {});
+    // Variants of the extrusion commands appending to the target string, to avoid
+    // a temporary allocation per command on the hot path of the extrusion loop.
+    void        extrude_to_xy(std::string &gcode, const Vec2d &point, double dE, const std::string_view comment = {});
+    void        extrude_to_xyz(std::string &gcode, const Vec3d &point, double dE, const std::string_view comment = {});
+    void        extrude_to_xy_G2G3IJ(std::string &gcode, const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment);
 
     std::string extrude_to_xy_G2G3IJ(const Vec2d &point, const Vec2d &ij, const bool ccw, double dE, const std::string_view comment);
 
@@ -266,6 +273,14 @@ public:
         return std::string(this->buf, ptr_err.ptr - buf);
     }
 
+    // Append the formatted command directly to the target string without allocating
+    // a temporary std::string. Used on the hot path of the extrusion loop, where
+    // a command rarely fits into the small string optimization buffer.
+    void string_to(std::string &out) {
+        *ptr_err.ptr ++ = '\n';
+        out.append(this->buf, ptr_err.ptr - buf);
+    }
+
 protected:
     static constexpr const size_t   buflen = 256;
     char                            buf[buflen];
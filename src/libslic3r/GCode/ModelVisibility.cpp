@@ -126,39 +126,39 @@ std::vector<float> raycast_visibility(
                     &raycasting_tree, &result, &samples, &params](tbb::blocked_range<size_t> r) {
                 // Maintaining hits memory outside of the loop, so it does not have to be reallocated for each query.
                 std::vector<igl::Hit> hits;
+                const float decrease_step = 1.0f
+                        / (params.sqr_rays_per_sample_point * params.sqr_rays_per_sample_point);
                 for (size_t s_idx = r.begin(); s_idx < r.end(); ++s_idx) {
-                    result[s_idx] = 1.0f;
-                    const float decrease_step = 1.0f
-                            / (params.sqr_rays_per_sample_point * params.sqr_rays_per_sample_point);
-
                     const Vec3f &center = samples.positions[s_idx];
                     const Vec3f &normal = samples.normals[s_idx];
                     // apply the local direction via Frame struct - the local_dir is with respect to +Z being forward
                     Frame f;
                     f.set_from_z(normal);
+                    size_t occluded_rays = 0;
 
-                    for (const auto &dir : precomputed_sample_directions) {
-                        Vec3f final_ray_dir = (f.to_world(dir));
-                        if (!model_contains_negative_parts) {
+                    if (!model_contains_negative_parts) {
+                        // All rays of this sample point share the origin, lift it above the surface once.
+                        const Vec3d ray_origin_d = (center + normal * 0.01f).cast<double>();
+                        for (const auto &dir : precomputed_sample_directions) {
+                            Vec3f final_ray_dir = (f.to_world(dir));
                             igl::Hit hitpoint;
                             // FIXME: This AABBTTreeIndirect query will not compile for float ray origin and
                             // direction.
                             Vec3d final_ray_dir_d = final_ray_dir.cast<double>();
-                            Vec3d ray_origin_d = (center + normal * 0.01f).cast<double>(); // start above surface.
                             bool hit = AABBTreeIndirect::intersect_ray_first_hit(triangles.vertices,
                                     triangles.indices, raycasting_tree, ray_origin_d, final_ray_dir_d, hitpoint);
-                            if (hit && its_face_normal(triangles, hitpoint.id).dot(final_ray_dir) <= 0) {
-                                result[s_idx] -= decrease_step;
-                            }
-                        } else { //TODO improve logic for order based boolean operations - consider order of volumes
-                            bool casting_from_negative_volume = samples.triangle_indices[s_idx]
-                                    >= negative_volumes_start_index;
-
-                            Vec3d ray_origin_d = (center + normal * 0.01f).cast<double>(); // start above surface.
-                            if (casting_from_negative_volume) { // if casting from negative volume face, invert direction, change start pos
+                            if (hit && its_face_normal(triangles, hitpoint.id).dot(final_ray_dir) <= 0)
+                                ++occluded_rays;
+                        }
+                    } else { //TODO improve logic for order based boolean operations - consider order of volumes
+                        const bool casting_from_negative_volume = samples.triangle_indices[s_idx]
+                                >= negative_volumes_start_index;
+                        // if casting from negative volume face, invert direction, change start pos
+                        const Vec3d ray_origin_d = (center + normal * (casting_from_negative_volume ? -0.01f : 0.01f)).cast<double>();
+                        for (const auto &dir : precomputed_sample_directions) {
+                            Vec3f final_ray_dir = (f.to_world(dir));
+                            if (casting_from_negative_volume)
                                 final_ray_dir = -1.0 * final_ray_dir;
-                                ray_origin_d = (center - normal * 0.01f).cast<double>();
-                            }
                             Vec3d final_ray_dir_d = final_ray_dir.cast<double>();
                             bool some_hit = AABBTreeIndirect::intersect_ray_all_hits(triangles.vertices,
                                     triangles.indices, raycasting_tree,
@@ -176,12 +176,12 @@ std::vector<float> raycast_visibility(
                                         counter += sgn(face_normal.dot(final_ray_dir));
                                     }
                                 }
-                                if (counter == 0) {
-                                    result[s_idx] -= decrease_step;
-                                }
+                                if (counter == 0)
+                                    ++occluded_rays;
                             }
                         }
                     }
+                    result[s_idx] = 1.0f - occluded_rays * decrease_step;
                 }
             });
 
@@ -623,9 +623,14 @@ void PressureEqualizer::adjust_volumetric_rate(const size_t first_line_idx, cons
         // Nothing to do, the last move is not extruding.
         return;
 
-    std::array<float, size_t(GCodeExtrusionRole::Count)> feedrate_per_extrusion_role{};
-    feedrate_per_extrusion_role.fill(std::numeric_limits<float>::max());
-    feedrate_per_extrusion_role[int(m_gcode_lines[line_idx].extrusion_role)] = m_gcode_lines[line_idx].volumetric_extrusion_rate_start;
+    // Only the extrusion role of the line seeding a sweep may ever carry a rate limit through it:
+    // all the other roles start out unlimited and the limit of a role is only ever updated after
+    // the role was found limited already. Thus instead of iterating a rate limit table over all of
+    // GCodeExtrusionRole (which used to spend all but one iteration per line skipping unlimited
+    // roles), track the single limiting role and its rate directly.
+    GCodeExtrusionRole limiting_role = m_gcode_lines[line_idx].extrusion_role;
+    float              limiting_rate = m_gcode_lines[line_idx].volumetric_extrusion_rate_start;
+    const float rate_slope_negative  = m_max_volumetric_extrusion_rate_slopes[size_t(limiting_role)].negative;
 
     while (line_idx != first_line_idx) {
         size_t idx_prev = line_idx - 1;
@@ -643,13 +648,10 @@ void PressureEqualizer::adjust_volumetric_rate(const size_t first_line_idx, cons
         line_idx        = idx_prev;
         GCodeLine &line = m_gcode_lines[line_idx];
 
-        for (size_t iRole = 1; iRole < size_t(GCodeExtrusionRole::Count); ++ iRole) {
-            const float &rate_slope = m_max_volumetric_extrusion_rate_slopes[iRole].negative;
-            if (rate_slope == 0 || feedrate_per_extrusion_role[iRole] == std::numeric_limits<float>::max())
-                continue; // The negative rate is unlimited or the rate for GCodeExtrusionRole iRole is unlimited.
-
-            float rate_end = feedrate_per_extrusion_role[iRole];
-            if (iRole == size_t(line.extrusion_role) && rate_succ < rate_end)
+        // With the negative rate unlimited for the limiting role, the sweep only walks the lines.
+        if (rate_slope_negative != 0) {
+            float rate_end = limiting_rate;
+            if (limiting_role == line.extrusion_role && rate_succ < rate_end)
                 // Limit by the succeeding volumetric flow rate.
                 rate_end = rate_succ;
 
@@ -658,33 +660,34 @@ void PressureEqualizer::adjust_volumetric_rate(const size_t first_line_idx, cons
                 rate_end = line.volumetric_extrusion_rate_end;
             } else if (line.volumetric_extrusion_rate_end > rate_end) {
                 line.volumetric_extrusion_rate_end = rate_end;
-                line.max_volumetric_extrusion_rate_slope_negative = rate_slope;
+                line.max_volumetric_extrusion_rate_slope_negative = rate_slope_negative;
                 line.modified = true;
-            } else if (iRole == size_t(line.extrusion_role)) {
+            } else if (limiting_role == line.extrusion_role) {
                 rate_end = line.volumetric_extrusion_rate_end;
             } else {
                 // Use the original, 'floating' extrusion rate as a starting point for the limiter.
             }
 
             if (line.adjustable_flow) {
-                float rate_start = sqrt(rate_end * rate_end + 2 * line.volumetric_extrusion_rate * line.dist_xyz() * rate_slope / line.feedrate());
+                float rate_start = sqrt(rate_end * rate_end + 2 * line.volumetric_extrusion_rate * line.dist_xyz() * rate_slope_negative / line.feedrate());
                 if (rate_start < line.volumetric_extrusion_rate_start) {
                     // Limit the volumetric extrusion rate at the start of this segment due to a segment
-                    // of ExtrusionType iRole, which will be extruded in the future.
+                    // of ExtrusionType limiting_role, which will be extruded in the future.
                     line.volumetric_extrusion_rate_start = rate_start;
-                    line.max_volumetric_extrusion_rate_slope_negative = rate_slope;
+                    line.max_volumetric_extrusion_rate_slope_negative = rate_slope_negative;
                     line.modified = true;
                 }
             }
 
             // Don't store feed rate for ironing.
             if (line.extrusion_role != GCodeExtrusionRole::Ironing)
-                feedrate_per_extrusion_role[iRole] = line.volumetric_extrusion_rate_start;
+                limiting_rate = line.volumetric_extrusion_rate_start;
         }
     }
 
-    feedrate_per_extrusion_role.fill(std::numeric_limits<float>::max());
-    feedrate_per_extrusion_role[size_t(m_gcode_lines[line_idx].extrusion_role)] = m_gcode_lines[line_idx].volumetric_extrusion_rate_end;
+    limiting_role = m_gcode_lines[line_idx].extrusion_role;
+    limiting_rate = m_gcode_lines[line_idx].volumetric_extrusion_rate_end;
+    const float rate_slope_positive = m_max_volumetric_extrusion_rate_slopes[size_t(limiting_role)].positive;
 
     assert(m_gcode_lines[line_idx].extruding());
     while (line_idx != last_line_idx) {
@@ -702,41 +705,38 @@ void PressureEqualizer::adjust_volumetric_rate(const size_t first_line_idx, cons
         line_idx = idx_next;
         GCodeLine &line = m_gcode_lines[line_idx];
 
-        for (size_t iRole = 1; iRole < size_t(GCodeExtrusionRole::Count); ++ iRole) {
-            const float &rate_slope = m_max_volumetric_extrusion_rate_slopes[iRole].positive;
-            if (rate_slope == 0 || feedrate_per_extrusion_role[iRole] == std::numeric_limits<float>::max())
-                continue; // The positive rate is unlimited or the rate for GCodeExtrusionRole iRole is unlimited.
-
-            float rate_start = feedrate_per_extrusion_role[iRole];
+        // With the positive rate unlimited for the limiting role, the sweep only walks the lines.
+        if (rate_slope_positive != 0) {
+            float rate_start = limiting_rate;
             // Don't alter the flow rate for these extrusion types.
             if (!line.adjustable_flow || line.extrusion_role == GCodeExtrusionRole::BridgeInfill || line.extrusion_role == GCodeExtrusionRole::Ironing) {
                 rate_start = line.volumetric_extrusion_rate_start;
-            } else if (iRole == size_t(line.extrusion_role) && rate_prec < rate_start)
+            } else if (limiting_role == line.extrusion_role && rate_prec < rate_start)
                 rate_start = rate_prec;
             if (line.volumetric_extrusion_rate_start > rate_start) {
                 line.volumetric_extrusion_rate_start = rate_start;
-                line.max_volumetric_extrusion_rate_slope_positive = rate_slope;
+                line.max_volumetric_extrusion_rate_slope_positive = rate_slope_positive;
                 line.modified = true;
-            } else if (iRole == size_t(line.extrusion_role)) {
+            } else if (limiting_role == line.extrusion_role) {
                 rate_start = line.volumetric_extrusion_rate_start;
             } else {
                 // Use the original, 'floating' extrusion rate as a starting point for the limiter.
             }
 
             if (line.adjustable_flow) {
-                float rate_end = sqrt(rate_start * rate_start + 2 * line.volumetric_extrusion_rate * line.dist_xyz() * rate_slope / line.feedrate());
+                float rate_end = sqrt(rate_start * rate_start + 2 * line.volumetric_extrusion_rate * line.dist_xyz() * rate_slope_positive / line.feedrate());
                 if (rate_end < line.volumetric_extrusion_rate_end) {
                     // Limit the volumetric extrusion rate at the start of this segment due to a segment
-                    // of ExtrusionType iRole, which was extruded before.
+                    // of ExtrusionType limiting_role, which was extruded before.
                     line.volumetric_extrusion_rate_end                = rate_end;
-                    line.max_volumetric_extrusion_rate_slope_positive = rate_slope;
+                    line.max_volumetric_extrusion_rate_slope_positive = rate_slope_positive;
                     line.modified                                     = true;
                 }
             }
 
             // Don't store feed rate for ironing
             if (line.extrusion_role != GCodeExtrusionRole::Ironing)
-                feedrate_per_extrusion_role[iRole] = line.volumetric_extrusion_rate_end;
+                limiting_rate = line.volumetric_extrusion_rate_end;
         }
     }
 }
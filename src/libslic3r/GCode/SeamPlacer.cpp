@@ -8,6 +8,8 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <mutex>
+
 #include "SeamPlacer.hpp"
 
 #include "libslic3r/ClipperUtils.hpp"
@@ -65,6 +67,77 @@ Perimeters::LayerPerimeters sort_to_layers(Shells::Shells<> &&shells) {
     return result;
 }
 
+namespace {
+
+// Fingerprint of everything the visibility raycasting depends on: the occlusion geometry
+// with its transformations and the raycasting parameters.
+std::size_t visibility_fingerprint(
+    const Transform3d &transformation,
+    const ModelVolumePtrs &volumes,
+    const Slic3r::ModelInfo::Visibility::Params &params
+) {
+    // FNV-1a.
+    std::size_t hash{0xcbf29ce484222325};
+    auto hash_bytes = [&hash](const void *data, const std::size_t size) {
+        for (const char *byte = static_cast<const char *>(data), *end = byte + size; byte != end; ++byte) {
+            hash ^= static_cast<unsigned char>(*byte);
+            hash *= 0x100000001b3;
+        }
+    };
+    hash_bytes(transformation.matrix().data(), transformation.matrix().size() * sizeof(double));
+    hash_bytes(&params.raycasting_visibility_samples_count, sizeof(params.raycasting_visibility_samples_count));
+    hash_bytes(&params.fast_decimation_triangle_count_target, sizeof(params.fast_decimation_triangle_count_target));
+    hash_bytes(&params.sqr_rays_per_sample_point, sizeof(params.sqr_rays_per_sample_point));
+    for (const ModelVolume *volume : volumes) {
+        if (volume->type() != ModelVolumeType::MODEL_PART &&
+            volume->type() != ModelVolumeType::NEGATIVE_VOLUME) {
+            // Other volume types do not enter the occlusion mesh.
+            continue;
+        }
+        const char volume_type{volume->type() == ModelVolumeType::MODEL_PART ? char(0) : char(1)};
+        hash_bytes(&volume_type, sizeof(volume_type));
+        const Transform3d volume_transformation{volume->get_matrix()};
+        hash_bytes(volume_transformation.matrix().data(), volume_transformation.matrix().size() * sizeof(double));
+        const indexed_triangle_set &its{volume->mesh().its};
+        hash_bytes(its.vertices.data(), its.vertices.size() * sizeof(its.vertices.front()));
+        hash_bytes(its.indices.data(), its.indices.size() * sizeof(its.indices.front()));
+    }
+    return hash;
+}
+
+// The occlusion raycasting is by far the most expensive part of the aligned seam placement,
+// while its inputs rarely change between exports. Keep the results of the recent exports
+// around, so that seam re-placement after e.g. a settings change does not pay for it again.
+std::shared_ptr<const Slic3r::ModelInfo::Visibility> get_visibility(
+    const Transform3d &transformation,
+    const ModelVolumePtrs &volumes,
+    const Slic3r::ModelInfo::Visibility::Params &params,
+    const std::function<void(void)> &throw_if_canceled
+) {
+    static std::mutex cache_mutex;
+    static std::map<std::size_t, std::shared_ptr<const Slic3r::ModelInfo::Visibility>> cache;
+
+    const std::size_t fingerprint{visibility_fingerprint(transformation, volumes, params)};
+    {
+        const std::lock_guard<std::mutex> lock{cache_mutex};
+        if (const auto it{cache.find(fingerprint)}; it != cache.end()) {
+            return it->second;
+        }
+    }
+    auto visibility{std::make_shared<const Slic3r::ModelInfo::Visibility>(
+        transformation, volumes, params, throw_if_canceled
+    )};
+    const std::lock_guard<std::mutex> lock{cache_mutex};
+    if (cache.size() >= 8) {
+        // Keep the cache bounded. The entries of the current export are recreated right away.
+        cache.clear();
+    }
+    cache.emplace(fingerprint, visibility);
+    return visibility;
+}
+
+} // namespace
+
 ObjectSeams precalculate_seams(
     const Params &params,
     ObjectLayerPerimeters &&seam_data,
@@ -78,11 +151,11 @@ ObjectSeams precalculate_seams(
             const Transform3d transformation{print_object->trafo_centered()};
             const ModelVolumePtrs &volumes{print_object->model_object()->volumes};
 
-            Slic3r::ModelInfo::Visibility
-                points_visibility{transformation, volumes, params.visibility, throw_if_canceled};
+            const std::shared_ptr<const Slic3r::ModelInfo::Visibility> points_visibility{
+                get_visibility(transformation, volumes, params.visibility, throw_if_canceled)};
             throw_if_canceled();
             const Aligned::VisibilityCalculator visibility_calculator{
-                points_visibility, params.convex_visibility_modifier,
+                *points_visibility, params.convex_visibility_modifier,
                 params.concave_visibility_modifier};
 
             Shells::Shells<> shells{Shells::create_shells(std::move(layer_perimeters), params.max_distance)};
@@ -20,6 +20,7 @@
 #include <string>
 #include <utility>
 
+#include "../Execution/ExecutionTBB.hpp"
 #include "../Point.hpp"
 #include "../PrintConfig.hpp"
 #include "ThumbnailData.hpp"
@@ -53,36 +54,73 @@ std::pair<GCodeThumbnailDefinitionsList, ThumbnailErrors> make_and_check_thumbna
 
 std::string get_error_string(const ThumbnailErrors& errors);
 
+// Render all the requested thumbnail sizes in a single callback invocation and pair the
+// rendered images with their formats. In the GUI the callback round-trips to the UI thread
+// which owns the OpenGL context, so batching the sizes blocks the export (and the UI)
+// just once instead of once per thumbnail.
+template<typename ThrowIfCanceledCallback>
+inline std::vector<std::pair<ThumbnailData, GCodeThumbnailsFormat>> render_thumbnails(
+    ThumbnailsGeneratorCallback &thumbnail_cb, const GCodeThumbnailDefinitionsList &thumbnails_list, ThrowIfCanceledCallback throw_if_canceled)
+{
+    ThumbnailsParams params{ {}, true, true, true, true };
+    params.sizes.reserve(thumbnails_list.size());
+    for (const auto& [format, size] : thumbnails_list)
+        params.sizes.emplace_back(size);
+    ThumbnailsList thumbnails = thumbnail_cb(params);
+    throw_if_canceled();
+
+    // The generator drops the thumbnails it could not render while keeping the order
+    // of the requested sizes, thus pair the images with their formats by walking both
+    // lists and matching the rendered resolutions.
+    std::vector<std::pair<ThumbnailData, GCodeThumbnailsFormat>> rendered;
+    rendered.reserve(thumbnails.size());
+    size_t def_idx = 0;
+    for (ThumbnailData& data : thumbnails) {
+        while (def_idx < thumbnails_list.size() && Point(thumbnails_list[def_idx].second) != Point(coord_t(data.width), coord_t(data.height)))
+            ++def_idx;
+        if (def_idx == thumbnails_list.size())
+            break;
+        if (data.is_valid())
+            rendered.emplace_back(std::move(data), thumbnails_list[def_idx].first);
+        ++def_idx;
+    }
+    return rendered;
+}
+
 template<typename WriteToOutput, typename ThrowIfCanceledCallback>
 inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb, const std::vector<std::pair<GCodeThumbnailsFormat, Vec2d>>& thumbnails_list, WriteToOutput output, ThrowIfCanceledCallback throw_if_canceled)
 {
     // Write thumbnails using base64 encoding
     if (thumbnail_cb != nullptr) {
-        for (const auto& [format, size] : thumbnails_list) {
-            static constexpr const size_t max_row_length = 78;
-            ThumbnailsList thumbnails = thumbnail_cb(ThumbnailsParams{ {size}, true, true, true, true });
-            for (const ThumbnailData& data : thumbnails)
-                if (data.is_valid()) {
-                    auto compressed = compress_thumbnail(data, format);
-                    if (compressed->data && compressed->size) {
-                        std::string encoded;
-                        encoded.resize(boost::beast::detail::base64::encoded_size(compressed->size));
-                        encoded.resize(boost::beast::detail::base64::encode((void*)encoded.data(), (const void*)compressed->data, compressed->size));
-
-                        output((boost::format("\n;\n; %s begin %dx%d %d\n") % compressed->tag() % data.width % data.height % encoded.size()).str().c_str());
-
-                        while (encoded.size() > max_row_length) {
-                            output((boost::format("; %s\n") % encoded.substr(0, max_row_length)).str().c_str());
-                            encoded = encoded.substr(max_row_length);
-                        }
-
-                        if (encoded.size() > 0)
-                            output((boost::format("; %s\n") % encoded).str().c_str());
-
-                        output((boost::format("; %s end\n;\n") % compressed->tag()).str().c_str());
-                    }
-                    throw_if_canceled();
+        static constexpr const size_t max_row_length = 78;
+        // Rendering happens in a single batch on the thread owning the OpenGL context,
+        // compressing the rendered images is independent and runs in parallel.
+        std::vector<std::pair<ThumbnailData, GCodeThumbnailsFormat>> rendered = render_thumbnails(thumbnail_cb, thumbnails_list, throw_if_canceled);
+        std::vector<std::unique_ptr<CompressedImageBuffer>> compressed(rendered.size());
+        execution::for_each(ex_tbb, size_t(0), rendered.size(),
+            [&rendered, &compressed](size_t idx) {
+                compressed[idx] = compress_thumbnail(rendered[idx].first, rendered[idx].second);
+            }, execution::max_concurrency(ex_tbb));
+        for (size_t idx = 0; idx < compressed.size(); ++ idx) {
+            const ThumbnailData &data = rendered[idx].first;
+            if (compressed[idx]->data && compressed[idx]->size) {
+                std::string encoded;
+                encoded.resize(boost::beast::detail::base64::encoded_size(compressed[idx]->size));
+                encoded.resize(boost::beast::detail::base64::encode((void*)encoded.data(), (const void*)compressed[idx]->data, compressed[idx]->size));
+
+                output((boost::format("\n;\n; %s begin %dx%d %d\n") % compressed[idx]->tag() % data.width % data.height % encoded.size()).str().c_str());
+
+                while (encoded.size() > max_row_length) {
+                    output((boost::format("; %s\n") % encoded.substr(0, max_row_length)).str().c_str());
+                    encoded = encoded.substr(max_row_length);
                 }
+
+                if (encoded.size() > 0)
+                    output((boost::format("; %s\n") % encoded).str().c_str());
+
+                output((boost::format("; %s end\n;\n") % compressed[idx]->tag()).str().c_str());
+            }
+            throw_if_canceled();
         }
     }
 }
@@ -96,24 +134,28 @@ inline void generate_binary_thumbnails(ThumbnailsGeneratorCallback& thumbnail_cb
     out_thumbnails.clear();
     assert(thumbnail_cb != nullptr);
     if (thumbnail_cb != nullptr) {
-        for (const auto& [format, size] : thumbnails_list) {
-            ThumbnailsList thumbnails = thumbnail_cb(ThumbnailsParams{ {size}, true, true, true, true });
-            for (const ThumbnailData &data : thumbnails)
-                if (data.is_valid()) {
-                    auto compressed = compress_thumbnail(data, format);
-                    if (compressed->data != nullptr && compressed->size > 0) {
-                        ThumbnailBlock& block = out_thumbnails.emplace_back(ThumbnailBlock());
-                        block.params.width = (uint16_t)data.width;
-                        block.params.height = (uint16_t)data.height;
-                        switch (format) {
-                        case GCodeThumbnailsFormat::PNG: { block.params.format = (uint16_t)EThumbnailFormat::PNG; break; }
-                        case GCodeThumbnailsFormat::JPG: { block.params.format = (uint16_t)EThumbnailFormat::JPG; break; }
-                        case GCodeThumbnailsFormat::QOI: { block.params.format = (uint16_t)EThumbnailFormat::QOI; break; }
-                        }
-                        block.data.resize(compressed->size);
-                        memcpy(block.data.data(), compressed->data, compressed->size);
-                    }
+        // Rendering happens in a single batch on the thread owning the OpenGL context,
+        // compressing the rendered images is independent and runs in parallel.
+        std::vector<std::pair<ThumbnailData, GCodeThumbnailsFormat>> rendered = render_thumbnails(thumbnail_cb, thumbnails_list, throw_if_canceled);
+        std::vector<std::unique_ptr<CompressedImageBuffer>> compressed(rendered.size());
+        execution::for_each(ex_tbb, size_t(0), rendered.size(),
+            [&rendered, &compressed](size_t idx) {
+                compressed[idx] = compress_thumbnail(rendered[idx].first, rendered[idx].second);
+            }, execution::max_concurrency(ex_tbb));
+        for (size_t idx = 0; idx < compressed.size(); ++ idx) {
+            const ThumbnailData &data = rendered[idx].first;
+            if (compressed[idx]->data != nullptr && compressed[idx]->size > 0) {
+                ThumbnailBlock& block = out_thumbnails.emplace_back(ThumbnailBlock());
+                block.params.width = (uint16_t)data.width;
+                block.params.height = (uint16_t)data.height;
+                switch (rendered[idx].second) {
+                case GCodeThumbnailsFormat::PNG: { block.params.format = (uint16_t)EThumbnailFormat::PNG; break; }
+                case GCodeThumbnailsFormat::JPG: { block.params.format = (uint16_t)EThumbnailFormat::JPG; break; }
+                case GCodeThumbnailsFormat::QOI: { block.params.format = (uint16_t)EThumbnailFormat::QOI; break; }
                 }
+                block.data.resize(compressed[idx]->size);
+                memcpy(block.data.data(), compressed[idx]->data, compressed[idx]->size);
+            }
         }
     }
 }
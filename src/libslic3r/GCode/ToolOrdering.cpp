@@ -99,7 +99,18 @@ static double calc_max_layer_height(const PrintConfig &config, double max_object
 
 // For the use case when each object is printed separately
 // (print.config().complete_objects is true).
-ToolOrdering::ToolOrdering(const PrintObject &object, unsigned int first_extruder, bool prime_multi_material)
+ToolOrdering::ToolOrdering(const PrintObject &object, unsigned int first_extruder, bool prime_multi_material) :
+    ToolOrdering(object)
+{
+    if (! object.layers().empty())
+        this->reorder_and_finalize(object, first_extruder, prime_multi_material);
+}
+
+// Collect the extruders needed to print an object, without deciding their order yet.
+// The collected extruders do not depend on the extruder the object is started with,
+// thus they may be reused by all instances of the object in a sequential print,
+// finishing each instance with reorder_and_finalize().
+ToolOrdering::ToolOrdering(const PrintObject &object)
 {
     if (object.layers().empty())
         return;
@@ -114,10 +125,14 @@ ToolOrdering::ToolOrdering(const PrintObject &object, unsigned int first_extrude
             zs.emplace_back(layer->print_z);
         this->initialize_layers(zs);
     }
-    double max_layer_height = calc_max_layer_height(object.print()->config(), object.config().layer_height);
 
     // Collect extruders required to print the layers.
     this->collect_extruders(object, std::vector<std::pair<double, unsigned int>>(), std::vector<std::pair<double, unsigned int>>());
+}
+
+void ToolOrdering::reorder_and_finalize(const PrintObject &object, unsigned int first_extruder, bool prime_multi_material)
+{
+    double max_layer_height = calc_max_layer_height(object.print()->config(), object.config().layer_height);
 
     // Reorder the extruders to minimize tool switches.
     this->reorder_extruders(first_extruder);
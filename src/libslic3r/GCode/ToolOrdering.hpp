@@ -148,6 +148,16 @@ public:
     // (print.config.complete_objects is true).
     ToolOrdering(const PrintObject &object, unsigned int first_extruder, bool prime_multi_material = false);
 
+    // Collect the extruders of an object without deciding their order yet. Walking all the extrusions
+    // of the object is expensive and independent of the extruder the object is started with, thus the
+    // collected state may be copied and reused by all instances of the object in a sequential print,
+    // finishing each instance with reorder_and_finalize().
+    explicit ToolOrdering(const PrintObject &object);
+
+    // Finish a tool ordering collected by ToolOrdering(const PrintObject&) for an object instance
+    // started with first_extruder. To be called just once on a freshly collected instance.
+    void                reorder_and_finalize(const PrintObject &object, unsigned int first_extruder, bool prime_multi_material = false);
+
     // For the use case when all objects are printed at once.
     // (print.config.complete_objects is false).
     ToolOrdering(const Print &print, unsigned int first_extruder, bool prime_multi_material = false);
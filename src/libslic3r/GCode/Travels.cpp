@@ -438,6 +438,7 @@ Points3 generate_travel_to_extrusion(
     }
 
     Points global_xy_path;
+    global_xy_path.reserve(xy_path.points.size());
     for (const Point &point : xy_path.points) {
         global_xy_path.emplace_back(point + xy_path_coord_origin);
     }
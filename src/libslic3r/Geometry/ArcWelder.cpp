@@ -99,22 +99,27 @@ static inline bool circle_approximation_sufficient(const Circle &circle, const P
 {
     // The circle was calculated from the 1st and last point of the point sequence, thus the fitting of those points does not need to be evaluated.
     assert(end - begin >= 3);
+    assert(circle.radius > 0);
+
+    // Test the distance of a point from the circle center against <radius - tolerance, radius + tolerance>
+    // on squared values, saving a square root for each of the tested points.
+    const double dmin2 = circle.radius > tolerance ? sqr(circle.radius - tolerance) : 0.;
+    const double dmax2 = sqr(circle.radius + tolerance);
+    auto fits = [center = circle.center, dmin2, dmax2](const Point &pt) {
+        const double d2 = (pt - center).cast<double>().squaredNorm();
+        return d2 >= dmin2 && d2 <= dmax2;
+    };
 
     // Test the 1st point.
-    if (double distance_from_center = (*begin - circle.center).cast<double>().norm();
-        std::abs(distance_from_center - circle.radius) > tolerance)
+    if (! fits(*begin))
         return false;
 
     for (auto it = std::next(begin); it != end; ++ it) {
-        if (double distance_from_center = (*it - circle.center).cast<double>().norm();
-            std::abs(distance_from_center - circle.radius) > tolerance)
+        if (! fits(*it))
             return false;
         Point closest_point;
-        if (foot_pt_on_segment(*std::prev(it), *it, circle.center, closest_point)) {
-            if (double distance_from_center = (closest_point - circle.center).cast<double>().norm();
-                std::abs(distance_from_center - circle.radius) > tolerance)
-                return false;
-        }
+        if (foot_pt_on_segment(*std::prev(it), *it, circle.center, closest_point) && ! fits(closest_point))
+            return false;
     }
     return true;
 }
@@ -538,8 +543,17 @@ Path fit_path(const Points &src_in, double tolerance, double fit_circle_percent_
                         {
                             Vec2i64 v1 = arc->start_point.cast<int64_t>() - arc->center.cast<int64_t>();
                             Vec2i64 v2 = arc->end_point.cast<int64_t>() - arc->center.cast<int64_t>();
+                            // Test the distance of a point from the arc center against <radius - tolerance, radius + tolerance>
+                            // on squared values, saving a square root for each of the tested points.
+                            // arc->radius is negative for an arc spanning more than PI, for which the test
+                            // below fails on any point, the same as the original test on the signed radius.
+                            const double rlo   = double(arc->radius) - tolerance;
+                            const double rhi   = double(arc->radius) + tolerance;
+                            const double dmin2 = rlo > 0 ? sqr(rlo) : -1.;
+                            const double dmax2 = rhi > 0 ? sqr(rhi) : -1.;
                             do {
-                                if (std::abs((arc->center.cast<double>() - next_end->cast<double>()).norm() - arc->radius) >= tolerance ||
+                                if (const double d2 = (arc->center.cast<double>() - next_end->cast<double>()).squaredNorm();
+                                    d2 <= dmin2 || d2 >= dmax2 ||
                                     inside_arc_wedge_vectors(v1, v2,
                                         arc->radius > 0, arc->direction == Orientation::CCW,
                                         next_end->cast<int64_t>() - arc->center.cast<int64_t>()))
@@ -19,6 +19,10 @@ enum class VisitorReturnMask : unsigned int {
     CONTINUE_LEFT  = 1,
     CONTINUE_RIGHT = 2,
     STOP           = 4,
+    // Hint to visit the right child before the left one when both are to be visited.
+    // Lets a nearest neighbor visitor descend into the near side first, shrinking its search
+    // radius as quickly as possible so that the far subtree is pruned by the tighter radius.
+    RIGHT_FIRST    = 8,
 };
 
 // KD tree for N-dimensional closest point search.
@@ -186,10 +190,17 @@ private:
         unsigned int mask = visitor(m_nodes[node], dimension);
         if ((mask & (unsigned int)VisitorReturnMask::STOP) == 0) {
             size_t next_dimension = (++ dimension == NumDimensions) ? 0 : dimension;
-            if (mask & (unsigned int)VisitorReturnMask::CONTINUE_LEFT)
-                visit_recursive(left,  next_dimension, visitor);
-            if (mask & (unsigned int)VisitorReturnMask::CONTINUE_RIGHT)
-                visit_recursive(right, next_dimension, visitor);
+            if (mask & (unsigned int)VisitorReturnMask::RIGHT_FIRST) {
+                if (mask & (unsigned int)VisitorReturnMask::CONTINUE_RIGHT)
+                    visit_recursive(right, next_dimension, visitor);
+                if (mask & (unsigned int)VisitorReturnMask::CONTINUE_LEFT)
+                    visit_recursive(left,  next_dimension, visitor);
+            } else {
+                if (mask & (unsigned int)VisitorReturnMask::CONTINUE_LEFT)
+                    visit_recursive(left,  next_dimension, visitor);
+                if (mask & (unsigned int)VisitorReturnMask::CONTINUE_RIGHT)
+                    visit_recursive(right, next_dimension, visitor);
+            }
         }
     }
 
@@ -245,7 +256,12 @@ std::array<size_t, K> find_closest_points(
                     *it = res;
                 }
             }
-            return kdtree.descent_mask(point[dimension], results.front().distance_sq, idx, dimension);
+            unsigned int mask = kdtree.descent_mask(point[dimension], results.front().distance_sq, idx, dimension);
+            constexpr unsigned int continue_both = (unsigned int)VisitorReturnMask::CONTINUE_LEFT | (unsigned int)VisitorReturnMask::CONTINUE_RIGHT;
+            if ((mask & continue_both) == continue_both && point[dimension] > kdtree.coordinate(idx, dimension))
+                // The splitting plane intersects the search hypersphere, descend into the near side first.
+                mask |= (unsigned int)VisitorReturnMask::RIGHT_FIRST;
+            return mask;
         }
     } visitor(kdtree, point, filter);
 
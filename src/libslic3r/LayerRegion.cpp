@@ -128,6 +128,7 @@ void LayerRegion::make_perimeters(
         perimeter_regions,
         spiral_vase
     );
+    params.throw_on_cancel = this->layer()->object()->print()->make_try_cancel();
 
     // Cummulative sum of polygons over all the regions.
     const ExPolygons *lower_slices = this->layer()->lower_layer ? &this->layer()->lower_layer->lslices : nullptr;
@@ -23,10 +23,13 @@
 #include "MultipleBeds.hpp"
 
 #include <float.h>
+#include <cstring>
+#include <unordered_map>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/iostream.hpp>
 
@@ -361,6 +364,99 @@ void Model::duplicate_objects_grid(size_t x, size_t y, coordf_t dist)
     }
 }
 
+// Hash of the raw geometry of an object's volumes, used to bucket merge
+// candidates in merge_duplicate_objects(). Objects falling into the same
+// bucket are compared exactly afterwards.
+static size_t object_geometry_hash(const ModelObject &object)
+{
+    auto hash_words = [](size_t &seed, const void *data, size_t size_bytes) {
+        auto *words = static_cast<const uint32_t*>(data);
+        boost::hash_range(seed, words, words + size_bytes / sizeof(uint32_t));
+    };
+    size_t seed = object.volumes.size();
+    for (const ModelVolume *volume : object.volumes) {
+        const indexed_triangle_set &its = volume->mesh().its;
+        boost::hash_combine(seed, its.vertices.size());
+        boost::hash_combine(seed, its.indices.size());
+        hash_words(seed, its.vertices.data(), its.vertices.size() * sizeof(its.vertices.front()));
+        hash_words(seed, its.indices.data(), its.indices.size() * sizeof(its.indices.front()));
+    }
+    return seed;
+}
+
+// Merging objects into instances of a single object changes the result if the
+// objects carry any custom per-object or per-volume data, thus only plain
+// objects are considered.
+static bool object_mergeable(const ModelObject &object)
+{
+    if (object.is_cut() || ! object.sla_support_points.empty() || ! object.sla_drain_holes.empty() ||
+        object.has_custom_layering())
+        return false;
+    for (const ModelVolume *volume : object.volumes)
+        if (volume->is_text() || volume->is_svg() || volume->is_cut_connector() ||
+            ! volume->supported_facets.empty() || ! volume->seam_facets.empty() ||
+            ! volume->mm_segmentation_facets.empty() || ! volume->fuzzy_skin_facets.empty())
+            return false;
+    return true;
+}
+
+// Test whether the two objects are geometrically identical including the volume
+// transforms and equivalent in configuration, so that one can become an
+// additional instance of the other with the world placement preserved.
+static bool objects_mergeable(const ModelObject &lhs, const ModelObject &rhs)
+{
+    if (lhs.volumes.size() != rhs.volumes.size() || lhs.printable != rhs.printable ||
+        ! lhs.config.get().equals(rhs.config.get()))
+        return false;
+    for (size_t i = 0; i < lhs.volumes.size(); ++ i) {
+        const ModelVolume &vl = *lhs.volumes[i];
+        const ModelVolume &vr = *rhs.volumes[i];
+        if (vl.type() != vr.type() || vl.material_id() != vr.material_id() ||
+            vl.get_matrix().matrix() != vr.get_matrix().matrix() ||
+            ! vl.config.get().equals(vr.config.get()))
+            return false;
+        if (vl.get_mesh_shared_ptr() != vr.get_mesh_shared_ptr()) {
+            const indexed_triangle_set &a = vl.mesh().its;
+            const indexed_triangle_set &b = vr.mesh().its;
+            if (a.vertices.size() != b.vertices.size() || a.indices.size() != b.indices.size() ||
+                memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(a.vertices.front())) != 0 ||
+                memcmp(a.indices.data(), b.indices.data(), a.indices.size() * sizeof(a.indices.front())) != 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+size_t Model::merge_duplicate_objects()
+{
+    // Canonical object for each geometry hash. Hash collisions are resolved
+    // by chaining inside the bucket.
+    std::unordered_map<size_t, std::vector<ModelObject*>> buckets;
+    ModelObjectPtrs duplicates;
+    for (ModelObject *object : this->objects) {
+        if (object->volumes.empty() || ! object_mergeable(*object)) {
+            // Keep the object as it is.
+            continue;
+        }
+        std::vector<ModelObject*> &bucket = buckets[object_geometry_hash(*object)];
+        auto it = std::find_if(bucket.begin(), bucket.end(),
+            [object](const ModelObject *candidate) { return objects_mergeable(*candidate, *object); });
+        if (it == bucket.end()) {
+            bucket.emplace_back(object);
+        } else {
+            // Turn the duplicate into additional instances of the canonical
+            // object. The volume transforms are equal, thus reusing the
+            // instance transforms keeps the world placement.
+            for (const ModelInstance *instance : object->instances)
+                (*it)->add_instance(*instance);
+            duplicates.emplace_back(object);
+        }
+    }
+    for (ModelObject *object : duplicates)
+        this->delete_object(object);
+    return duplicates.size();
+}
+
 void Model::adjust_min_z()
 {
     if (objects.empty())
@@ -874,6 +970,12 @@ BoundingBoxf3 ModelObject::instance_bounding_box(size_t instance_idx, bool dont_
 // This method is used by the auto arrange function.
 Polygon ModelObject::convex_hull_2d(const Transform3d& trafo_instance) const
 {
+    // The hulls of all the instances are queried repeatedly by arrange and by Print::apply(),
+    // serve them from the cache if the same transformation was already processed.
+    for (const std::pair<Transform3d, Polygon> &entry : m_convex_hull_2d_cache)
+        if (entry.first.matrix() == trafo_instance.matrix())
+            return entry.second;
+
     tbb::concurrent_vector<Polygon> chs;
     chs.reserve(volumes.size());
     tbb::parallel_for(tbb::blocked_range<size_t>(0, volumes.size()), [&](const tbb::blocked_range<size_t>& range) {
@@ -886,7 +988,14 @@ Polygon ModelObject::convex_hull_2d(const Transform3d& trafo_instance) const
 
     Polygons polygons;
     polygons.assign(chs.begin(), chs.end());
-    return Geometry::convex_hull(polygons);
+    Polygon hull = Geometry::convex_hull(polygons);
+
+    // Entries keyed on transformations that are no longer queried (for example after moving
+    // an instance) stay behind until the geometry changes, thus keep the cache bounded.
+    if (m_convex_hull_2d_cache.size() >= 1000)
+        m_convex_hull_2d_cache.clear();
+    m_convex_hull_2d_cache.emplace_back(trafo_instance, hull);
+    return hull;
 }
 
 void ModelObject::center_around_origin(bool include_modifiers)
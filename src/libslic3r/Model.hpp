@@ -456,12 +456,13 @@ public:
     double                  min_z() const;
     double                  max_z() const;
 
-    void invalidate_bounding_box() { 
+    void invalidate_bounding_box() {
         m_bounding_box_approx_valid     = false;
         m_bounding_box_exact_valid      = false;
         m_min_max_z_valid               = false;
         m_raw_bounding_box_valid        = false;
         m_raw_mesh_bounding_box_valid   = false;
+        m_convex_hull_2d_cache.clear();
     }
 
     // A mesh containing all transformed instances of this object.
@@ -483,7 +484,8 @@ public:
 
     // Calculate 2D convex hull of of a projection of the transformed printable volumes into the XY plane.
     // This method is cheap in that it does not make any unnecessary copy of the volume meshes.
-    // This method is used by the auto arrange function.
+    // This method is used by the auto arrange function. The result is cached per instance transformation,
+    // the cache is thrown away whenever the object geometry changes (see invalidate_bounding_box()).
     Polygon       convex_hull_2d(const Transform3d &trafo_instance) const;
 
     void center_around_origin(bool include_modifiers = true);
@@ -637,6 +639,8 @@ private:
     mutable bool          m_raw_bounding_box_valid { false };
     mutable BoundingBoxf3 m_raw_mesh_bounding_box;
     mutable bool          m_raw_mesh_bounding_box_valid { false };
+    // Results of convex_hull_2d(), one entry per recently queried instance transformation.
+    mutable std::vector<std::pair<Transform3d, Polygon>> m_convex_hull_2d_cache;
 
     // Only use this method if now the source and dest ModelObjects are equal, for example they were synchronized by Print::apply().
     void copy_transformation_caches(const ModelObject &src) {
@@ -649,6 +653,7 @@ private:
         m_raw_bounding_box_valid          = src.m_raw_bounding_box_valid;
         m_raw_mesh_bounding_box           = src.m_raw_mesh_bounding_box;
         m_raw_mesh_bounding_box_valid     = src.m_raw_mesh_bounding_box_valid;
+        m_convex_hull_2d_cache            = src.m_convex_hull_2d_cache;
     }
 
     // Called by Print::apply() to set the model pointer after making a copy.
@@ -1329,6 +1334,13 @@ public:
     // Croaks if the duplicated objects do not fit the print bed.
     void duplicate_objects_grid(size_t x, size_t y, coordf_t dist);
 
+    // Merge objects with identical volume geometry, transforms and configuration
+    // into instances of a single object, so that they share a PrintObject and
+    // their slices are calculated just once. Objects carrying custom per-object
+    // or per-volume data (painting, layer ranges, SLA points, cuts) are left
+    // alone. Returns the number of objects removed.
+    size_t        merge_duplicate_objects();
+
     // Ensures that the min z of the model is not negative
     void 		  adjust_min_z();
 
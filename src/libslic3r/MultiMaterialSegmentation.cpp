@@ -858,8 +858,15 @@ static inline std::vector<std::vector<ExPolygons>> segmentation_top_and_bottom_l
         for (const ModelVolume *mv : print_object.model_object()->volumes)
             if (mv->is_model_part()) {
                 const Transform3d volume_trafo = object_trafo * mv->get_matrix();
+                // Deserialize the painted state just once per volume. Constructing a TriangleSelector
+                // over the mesh is O(mesh size), so doing it inside the loop below would repeat that
+                // work for every facet state.
+                const ModelVolumeFacetsInfo facets_info = extract_facets_info(*mv);
+                TriangleSelector            selector(mv->mesh());
+                // Reset of TriangleSelector is done inside TriangleSelector's constructor, so we don't need it to perform it again in deserialize().
+                selector.deserialize(facets_info.facets_annotation.get_data(), false);
                 for (size_t extruder_idx = 0; extruder_idx < num_facets_states; ++extruder_idx) {
-                    const indexed_triangle_set painted = extract_facets_info(*mv).facets_annotation.get_facets_strict(*mv, TriangleStateType(extruder_idx));
+                    const indexed_triangle_set painted = selector.get_facets_strict(TriangleStateType(extruder_idx));
 
                     if constexpr (MM_SEGMENTATION_DEBUG_TOP_BOTTOM) {
                         its_write_obj(painted, debug_out_path("mm-painted-patch-%d.obj", extruder_idx).c_str());
@@ -32,6 +32,7 @@
 #include <vector>
 #include <cstddef>
 
+#include "libslic3r/Execution/ExecutionTBB.hpp"
 #include "libslic3r/TriangleMesh.hpp"
 #include "libslic3r/libslic3r.h"
 
@@ -122,15 +123,24 @@ VoxelGridPtr mesh_to_grid(const indexed_triangle_set &mesh,
 
     Interrupter interrupter{params.statusfn()};
 
-    openvdb::FloatGrid::Ptr grid;
-    for (auto &m : meshparts) {
-        auto subgrid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
-            interrupter,
-            TriangleMeshDataAdapter{m, trafo},
-            openvdb::math::Transform{},
-            params.exterior_bandwidth(),
-            params.interior_bandwidth());
+    // Voxelize the mesh parts in parallel, the union of the resulting
+    // subgrids is cheap compared to meshToVolume. The status callback may be
+    // called concurrently, just like in voxelize_csgmesh(), so it has to be
+    // thread safe.
+    std::vector<openvdb::FloatGrid::Ptr> subgrids(meshparts.size());
+    execution::for_each(ex_tbb, size_t(0), meshparts.size(),
+        [&meshparts, &subgrids, &trafo, &params](size_t part_idx) {
+            Interrupter part_interrupter{params.statusfn()};
+            subgrids[part_idx] = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
+                part_interrupter,
+                TriangleMeshDataAdapter{meshparts[part_idx], trafo},
+                openvdb::math::Transform{},
+                params.exterior_bandwidth(),
+                params.interior_bandwidth());
+        }, execution::max_concurrency(ex_tbb));
 
+    openvdb::FloatGrid::Ptr grid;
+    for (auto &subgrid : subgrids) {
         if (interrupter.wasInterrupted())
             break;
 
@@ -1034,6 +1034,7 @@ void PerimeterGenerator::process_arachne(
     ExPolygons last   = offset_ex(surface.expolygon.simplify_p(params.scaled_resolution), - float(ext_perimeter_width / 2. - ext_perimeter_spacing / 2.));
     Polygons   last_p = to_polygons(last);
     Arachne::WallToolPaths wall_tool_paths(last_p, ext_perimeter_spacing, perimeter_spacing, coord_t(loop_number + 1), 0, params.layer_height, params.object_config, params.print_config);
+    wall_tool_paths.set_throw_on_cancel(params.throw_on_cancel);
     Arachne::Perimeters    perimeters     = wall_tool_paths.getToolPaths();
     ExPolygons             infill_contour = union_ex(wall_tool_paths.getInnerContour());
 
@@ -1072,6 +1073,7 @@ void PerimeterGenerator::process_arachne(
 
             const Polygons not_top_polygons = to_polygons(not_top_expolygons);
             Arachne::WallToolPaths inner_wall_tool_paths(not_top_polygons, perimeter_spacing, perimeter_spacing, coord_t(inner_loop_number + 1), 0, params.layer_height, params.object_config, params.print_config);
+            inner_wall_tool_paths.set_throw_on_cancel(params.throw_on_cancel);
             Arachne::Perimeters inner_perimeters = inner_wall_tool_paths.getToolPaths();
 
             // Recalculate indexes of inner perimeters before merging them.
@@ -1091,6 +1093,7 @@ void PerimeterGenerator::process_arachne(
             // There is no top surface ExPolygon, so we call Arachne again with parameters
             // like when the single perimeter feature is disabled.
             Arachne::WallToolPaths no_single_perimeter_tool_paths(last_p, ext_perimeter_spacing, perimeter_spacing, coord_t(inner_loop_number + 2), 0, params.layer_height, params.object_config, params.print_config);
+            no_single_perimeter_tool_paths.set_throw_on_cancel(params.throw_on_cancel);
             perimeters     = no_single_perimeter_tool_paths.getToolPaths();
             infill_contour = union_ex(no_single_perimeter_tool_paths.getInnerContour());
         }
@@ -7,6 +7,7 @@
 #ifndef slic3r_PerimeterGenerator_hpp_
 #define slic3r_PerimeterGenerator_hpp_
 
+#include <functional>
 #include <vector>
 
 #include "libslic3r.h"
@@ -90,6 +91,8 @@ struct Parameters {
     const PrintObjectConfig     &object_config;
     const PrintConfig           &print_config;
     const PerimeterRegions      &perimeter_regions;
+    // Called from the expensive perimeter generation steps, lets a canceled slicing job abort promptly.
+    std::function<void()>        throw_on_cancel { [](){} };
 
     // Derived parameters
     bool                         spiral_vase;
@@ -2362,6 +2362,12 @@ static std::string process_macro(const std::string &templ, client::MyContext &co
 
 std::string PlaceholderParser::process(const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
 {
+    // A template without any '{' or '[' expands to itself, thus skip the spirit parser.
+    // Custom G-code blocks are often plain text and this is called repeatedly during
+    // the export, for example once per layer for the layer change G-code.
+    if (templ.find_first_of("{[") == std::string::npos)
+        return templ;
+
     client::MyContext context;
     context.external_config 	= this->external_config();
     context.config              = &this->config();
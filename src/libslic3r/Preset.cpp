@@ -24,8 +24,11 @@
 
 #include <algorithm>
 #include <fstream>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <boost/range/join.hpp>
 #include <boost/format.hpp>
 #include <boost/filesystem.hpp>
@@ -788,6 +791,9 @@ void PresetCollection::load_presets(
     // Store the loaded presets into a new vector, otherwise the binary search for already existing presets would be broken.
     // (see the "Preset already present, not loading" message).
     std::deque<Preset> presets_loaded;
+
+    // Collect the preset files first, so that their contents can be parsed in parallel.
+    std::vector<boost::filesystem::path> preset_paths;
     for (auto &dir_entry : boost::filesystem::directory_iterator(dir))
         if (Slic3r::is_ini_file(dir_entry)) {
             std::string name = dir_entry.path().filename().string();
@@ -799,15 +805,30 @@ void PresetCollection::load_presets(
                 BOOST_LOG_TRIVIAL(warning) << "Preset already present, not loading: " << name;
                 continue;
             }
+            preset_paths.emplace_back(dir_entry.path());
+        }
+
+    struct ParsedPreset {
+        std::optional<Preset> preset;
+        ConfigSubstitutions   config_substitutions;
+        std::string           error;
+    };
+    // Parsing the preset files is independent, run it in parallel. The results are merged
+    // serially afterwards to keep the load order and the error reporting deterministic.
+    std::vector<ParsedPreset> parsed(preset_paths.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, preset_paths.size()),
+        [this, &preset_paths, &parsed, substitution_rule](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i) {
+            std::string name = preset_paths[i].filename().string();
+            // Remove the .ini suffix.
+            name.erase(name.size() - 4);
             try {
                 Preset preset(m_type, name, false);
-                preset.file = dir_entry.path().string();
+                preset.file = preset_paths[i].string();
                 // Load the preset file, apply preset values on top of defaults.
                 try {
                     DynamicPrintConfig config;
-                    ConfigSubstitutions config_substitutions = config.load_from_ini(preset.file, substitution_rule);
-                    if (! config_substitutions.empty())
-                        substitutions.push_back({ preset.name, m_type, PresetConfigSubstitutions::Source::UserFile, preset.file, std::move(config_substitutions) });
+                    parsed[i].config_substitutions = config.load_from_ini(preset.file, substitution_rule);
                     // Find a default preset for the config. The PrintPresetCollection provides different default preset based on the "printer_technology" field.
                     const Preset &default_preset = this->default_preset_for(config);
                     preset.config = default_preset.config;
@@ -824,12 +845,23 @@ void PresetCollection::load_presets(
                 } catch (const std::runtime_error &err) {
                     throw Slic3r::RuntimeError(std::string("Failed loading the preset file: ") + preset.file + "\n\tReason: " + err.what());
                 }
-                presets_loaded.emplace_back(preset);
+                parsed[i].preset = std::move(preset);
             } catch (const std::runtime_error &err) {
-                errors_cummulative += err.what();
-                errors_cummulative += "\n";
+                parsed[i].error = err.what();
             }
         }
+    });
+
+    for (ParsedPreset &pp : parsed) {
+        if (! pp.error.empty()) {
+            errors_cummulative += pp.error;
+            errors_cummulative += "\n";
+            continue;
+        }
+        if (! pp.config_substitutions.empty())
+            substitutions.push_back({ pp.preset->name, m_type, PresetConfigSubstitutions::Source::UserFile, pp.preset->file, std::move(pp.config_substitutions) });
+        presets_loaded.emplace_back(std::move(*pp.preset));
+    }
     m_presets.insert(m_presets.end(), std::make_move_iterator(presets_loaded.begin()), std::make_move_iterator(presets_loaded.end()));
     std::sort(m_presets.begin() + m_num_default_presets, m_presets.end());
     this->select_preset(first_visible_idx());
@@ -1326,6 +1358,24 @@ size_t PresetCollection::update_compatible_internal(const PresetWithVendorProfil
     const ConfigOption *opt = active_printer.preset.config.option("nozzle_diameter");
     if (opt)
         config.set_key_value("num_extruders", new ConfigOptionInt((int)static_cast<const ConfigOptionFloats*>(opt)->values.size()));
+    // Evaluate the compatibility conditions in parallel: each evaluation may parse a
+    // compatible_printers_condition / compatible_prints_condition expression, which dominates
+    // this method with large preset libraries. The evaluation only reads the preset configs,
+    // all the bookkeeping (selection, template profile filtering) is applied serially below.
+    std::vector<unsigned char> compatible_with_printer(m_presets.size(), 0);
+    std::vector<unsigned char> compatible(m_presets.size(), 0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(m_num_default_presets, m_presets.size()),
+        [this, &active_printer, active_print, &config, &compatible_with_printer, &compatible](const tbb::blocked_range<size_t> &range) {
+            for (size_t idx_preset = range.begin(); idx_preset < range.end(); ++ idx_preset) {
+                const Preset &preset_edited = idx_preset == m_idx_selected ? m_edited_preset : m_presets[idx_preset];
+                const PresetWithVendorProfile this_preset_with_vendor_profile = this->get_preset_with_vendor_profile(preset_edited);
+                bool is_compatible = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config);
+                compatible_with_printer[idx_preset] = is_compatible;
+                if (is_compatible && active_print != nullptr)
+                    is_compatible = is_compatible_with_print(this_preset_with_vendor_profile, *active_print, active_printer);
+                compatible[idx_preset] = is_compatible;
+            }
+        });
     bool some_compatible = false;
     std::vector<size_t> indices_of_template_presets;
     for (size_t idx_preset = m_num_default_presets; idx_preset < m_presets.size(); ++ idx_preset) {
@@ -1333,12 +1383,9 @@ size_t PresetCollection::update_compatible_internal(const PresetWithVendorProfil
         Preset &preset_selected = m_presets[idx_preset];
         Preset &preset_edited   = selected ? m_edited_preset : preset_selected;
 
-        const PresetWithVendorProfile this_preset_with_vendor_profile = this->get_preset_with_vendor_profile(preset_edited);
         bool    was_compatible  = preset_edited.is_compatible;
-        preset_edited.is_compatible = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config);
-        some_compatible |= preset_edited.is_compatible;
-	    if (active_print != nullptr)
-	        preset_edited.is_compatible &= is_compatible_with_print(this_preset_with_vendor_profile, *active_print, active_printer);
+        preset_edited.is_compatible = compatible[idx_preset] != 0;
+        some_compatible |= compatible_with_printer[idx_preset] != 0;
         if (! preset_edited.is_compatible && selected &&
         	(unselect_if_incompatible == PresetSelectCompatibleType::Always || (unselect_if_incompatible == PresetSelectCompatibleType::OnlyIfWasCompatible && was_compatible)))
             m_idx_selected = size_t(-1);
@@ -2390,16 +2437,26 @@ size_t ExtruderFilaments::update_compatible_internal(const PresetWithVendorProfi
     indices_of_template_presets.reserve(m_extr_filaments.size());
 
     size_t num_default_presets = m_filaments->num_default_presets();
+    // Evaluate the compatibility conditions in parallel, the same way as in
+    // PresetCollection::update_compatible_internal(). The bookkeeping is applied serially below.
+    std::vector<unsigned char> compatible(m_extr_filaments.size(), 0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(num_default_presets, m_extr_filaments.size()),
+        [this, &active_printer_adjusted, active_print, &config, &compatible](const tbb::blocked_range<size_t> &range) {
+            for (size_t idx_preset = range.begin(); idx_preset < range.end(); ++ idx_preset) {
+                const PresetWithVendorProfile this_preset_with_vendor_profile = m_filaments->get_preset_with_vendor_profile(*m_extr_filaments[idx_preset].preset);
+                bool is_compatible = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer_adjusted, &config);
+                if (is_compatible && active_print != nullptr)
+                    is_compatible = is_compatible_with_print(this_preset_with_vendor_profile, *active_print, active_printer_adjusted);
+                compatible[idx_preset] = is_compatible;
+            }
+        });
     for (size_t idx_preset = num_default_presets; idx_preset < m_extr_filaments.size(); ++idx_preset) {
         const bool    is_selected   = idx_preset == m_idx_selected;
         const Preset* preset        = m_extr_filaments[idx_preset].preset;
         Filament& extr_filament = m_extr_filaments[idx_preset];
 
-        const PresetWithVendorProfile this_preset_with_vendor_profile = m_filaments->get_preset_with_vendor_profile(*preset);
         bool    was_compatible = extr_filament.is_compatible;
-        extr_filament.is_compatible = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer_adjusted, &config);
-        if (active_print != nullptr)
-            extr_filament.is_compatible &= is_compatible_with_print(this_preset_with_vendor_profile, *active_print, active_printer_adjusted);
+        extr_filament.is_compatible = compatible[idx_preset] != 0;
         if (!extr_filament.is_compatible && is_selected &&
             (unselect_if_incompatible == PresetSelectCompatibleType::Always || (unselect_if_incompatible == PresetSelectCompatibleType::OnlyIfWasCompatible && was_compatible)))
             m_idx_selected = size_t(-1);
@@ -68,6 +68,7 @@ void Print::clear()
 	m_objects.clear();
     m_print_regions.clear();
     m_model.clear_objects();
+    m_validation_cache.reset();
 }
 
 // Called by Print::apply().
@@ -439,6 +440,23 @@ boost::regex regex_g92e0 { "^[ \\t]*[gG]92[ \\t]*[eE](0(\\.0*)?|\\.0+)[ \\t]*(;.
 
 // Precondition: Print::validate() requires the Print::apply() to be called its invocation.
 std::string Print::validate(std::vector<std::string>* warnings) const
+{
+    // Everything validate() inspects is handed over through Print::apply(), thus the verdict cannot
+    // change while apply() keeps reporting APPLY_STATUS_UNCHANGED and the last one may be reused.
+    // The checks behave slightly differently when the caller asks for warnings, thus a cached
+    // verdict is only reused by a call requesting the same.
+    if (! m_validation_cache.has_value() || m_validation_cache->with_warnings != (warnings != nullptr)) {
+        ValidationCache cache;
+        cache.with_warnings = warnings != nullptr;
+        cache.error         = this->validate_uncached(cache.with_warnings ? &cache.warnings : nullptr);
+        m_validation_cache  = std::move(cache);
+    }
+    if (warnings)
+        *warnings = m_validation_cache->warnings;
+    return m_validation_cache->error;
+}
+
+std::string Print::validate_uncached(std::vector<std::string>* warnings) const
 {
     std::vector<unsigned int> extruders = this->extruders();
 
@@ -883,6 +901,12 @@ void Print::auto_assign_extruders(ModelObject* model_object) const
     }
 }
 
+std::string Print::profile_step_name(PrintStep step) const
+{
+    static constexpr const char* names[psCount] = { "wipe_tower", "alert_when_supports_needed", "skirt_brim", "gcode_export" };
+    return names[step];
+}
+
 // Slicing process, running at a background thread.
 void Print::process()
 {
@@ -1009,6 +1033,9 @@ std::string Print::export_gcode(const std::string& path_template, GCodeProcessor
     if (result)
         result->sequential_collision_detected = m_sequential_collision_detected;
 
+    if (StepProfiler::enabled())
+        StepProfiler::save();
+
     return path.c_str();
 }
 
@@ -42,7 +42,9 @@
 
 #include <Eigen/Geometry>
 
+#include <atomic>
 #include <functional>
+#include <map>
 #include <optional>
 #include <set>
 #include <tcbspan/span.hpp>
@@ -405,6 +407,8 @@ private:
     static PrintObjectConfig object_config_from_model_object(const PrintObjectConfig &default_object_config, const ModelObject &object, size_t num_extruders);
 
 private:
+    std::string profile_step_name(PrintObjectStep step) const override;
+
     void make_perimeters();
     void prepare_infill();
     void clear_fills();
@@ -414,6 +418,10 @@ private:
     void generate_support_material();
     void estimate_curled_extrusions();
     void calculate_overhanging_perimeters();
+    // Decimate the extrusions generated by the perimeter / infill steps to the configured
+    // G-code resolution, so that all downstream consumers work with paths the printer can
+    // actually execute. Called at the end of make_perimeters() and infill().
+    void simplify_extrusion_paths(bool simplify_perimeters, bool simplify_fills);
 
     void slice_volumes();
     // Has any support (not counting the raft).
@@ -426,7 +434,7 @@ private:
     void combine_infill();
     void _generate_support_material();
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> prepare_adaptive_infill_data(
-        const std::vector<std::pair<const Surface*, float>>& surfaces_w_bottom_z) const;
+        const std::vector<std::pair<const Surface*, float>>& surfaces_w_bottom_z);
     FillLightning::GeneratorPtr prepare_lightning_infill_data();
 
     // XYZ in scaled coordinates
@@ -453,7 +461,16 @@ private:
     bool                    				m_typed_slices = false;
 
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> m_adaptive_fill_octrees;
+    // Fingerprint of the inputs m_adaptive_fill_octrees were built from (mesh, transformation,
+    // cube spacings, internal bridge overhangs). Zero if the octrees are not valid.
+    size_t                      m_adaptive_fill_octrees_hash { 0 };
     FillLightning::GeneratorPtr m_lightning_generator;
+
+    // Cache of the last slice_volumes() result per model volume, making the re-slice after
+    // a layer height profile edit incremental: only the layers with new Z values are sliced.
+    // The cache verifies the mesh content hash, the composed volume transform and the slicing
+    // parameters itself, thus the apply() paths do not need to invalidate it.
+    std::map<ObjectID, MeshSliceCache> m_volume_slice_caches;
 };
 
 
@@ -677,6 +694,16 @@ public:
     const PrintStatistics&      print_statistics() const { return m_print_statistics; }
     PrintStatistics&            print_statistics() { return m_print_statistics; }
 
+    // Priority Z window for background slicing: layers inside the window (for example the layers
+    // currently visible in the 3D view) are scheduled first by the layer-parallel steps, so the
+    // user gets visual feedback on them before the rest of the plate is finished.
+    // An empty window (max < min, the default) disables prioritization. Safe to call from the UI
+    // thread while process() is running; the window is only a scheduling hint, it never changes
+    // the produced result.
+    void                set_priority_z_window(double min_z, double max_z) { m_priority_z_min.store(min_z); m_priority_z_max.store(max_z); }
+    void                clear_priority_z_window() { this->set_priority_z_window(0., -1.); }
+    std::pair<double, double> priority_z_window() const { return { m_priority_z_min.load(), m_priority_z_max.load() }; }
+
     // Wipe tower support.
     bool                        has_wipe_tower() const;
     const WipeTowerData&        wipe_tower_data(size_t extruders_cnt = 0) const;
@@ -701,6 +728,11 @@ protected:
 private:
     bool                invalidate_state_by_config_options(const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys);
 
+    std::string         profile_step_name(PrintStep step) const override;
+
+    // The actual validation checks, run by validate() when no memoized verdict is available.
+    std::string         validate_uncached(std::vector<std::string>* warnings) const;
+
     void                _make_skirt();
     void                _make_wipe_tower();
     void                finalize_first_layer_convex_hull();
@@ -748,8 +780,22 @@ private:
     // Allow PrintObject to access m_mutex and m_cancel_callback.
     friend class PrintObject;
 
+    // Verdict of the last validate() call together with the warnings it produced. Dropped by
+    // apply() whenever it changes anything, thus repeated validation of an untouched Print is free.
+    struct ValidationCache {
+        bool                        with_warnings;
+        std::string                 error;
+        std::vector<std::string>    warnings;
+    };
+    mutable std::optional<ValidationCache>  m_validation_cache;
+
     ConflictResultOpt m_conflict_result;
     std::optional<std::pair<std::string, std::string>> m_sequential_collision_detected; // names of objects (hit first when printing second)
+
+    // Priority Z window, see set_priority_z_window(). Kept in two atomics so the UI thread
+    // may update it while the background thread schedules work.
+    std::atomic<double> m_priority_z_min { 0. };
+    std::atomic<double> m_priority_z_max { -1. };
 };
 
 } /* slic3r_Print_hpp_ */
@@ -1597,6 +1597,10 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
     for (PrintObject *object : m_objects)
         object->update_slicing_parameters();
 
+    // Any change above may flip the verdict of validate(), drop its memoized result.
+    if (apply_status != APPLY_STATUS_UNCHANGED)
+        m_validation_cache.reset();
+
     if (apply_status == APPLY_STATUS_CHANGED || apply_status == APPLY_STATUS_INVALIDATED)
         this->cleanup();
 
@@ -12,11 +12,13 @@
 #include <functional>
 #include <atomic>
 #include <mutex>
+#include <new>
 
 #include "ObjectID.hpp"
 #include "Model.hpp"
 #include "PlaceholderParser.hpp"
 #include "PrintConfig.hpp"
+#include "StepProfiler.hpp"
 
 namespace Slic3r {
 
@@ -562,6 +564,16 @@ protected:
     status_callback_type                    m_status_callback;
 
 private:
+#if defined(__cpp_lib_hardware_interference_size) && ! defined(__APPLE__)
+    static constexpr size_t                 cancel_status_alignment = std::hardware_destructive_interference_size;
+#else
+    // 64 bytes on x86-64 │ L1_CACHE_BYTES │ L1_CACHE_SHIFT │ __cacheline_aligned │ ...
+    static constexpr size_t                 cancel_status_alignment = 64;
+#endif
+    // Read by every worker thread in throw_if_canceled(), which is called at a high frequency from
+    // the TBB parallel loops. Keep the flag on its own cache line, away from m_state_mutex and the
+    // callbacks, so that the workers' reads do not false-share with the milestone bookkeeping writes.
+    alignas(cancel_status_alignment)
     std::atomic<CancelStatus>               m_cancel_status;
 
     // Callback to be evoked to stop the background processing before a state is updated.
@@ -589,13 +601,22 @@ public:
     PrintStateBase::StateWithWarnings  step_state_with_warnings(PrintStepEnum step) const { return m_state.state_with_warnings(step, this->state_mutex()); }
 
 protected:
-    bool            set_started(PrintStepEnum step) { return m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); }); }
-	PrintStateBase::TimeStamp set_done(PrintStepEnum step) { 
+    bool            set_started(PrintStepEnum step) {
+        bool started = m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (started && StepProfiler::enabled())
+            StepProfiler::step_started(this->profile_step_name(step));
+        return started;
+    }
+	PrintStateBase::TimeStamp set_done(PrintStepEnum step) {
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (StepProfiler::enabled())
+            StepProfiler::step_finished(this->profile_step_name(step));
         if (status.second)
             this->status_update_warnings(static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
         return status.first;
 	}
+    // Name of the milestone shown in the opt-in step profiler traces.
+    virtual std::string profile_step_name(PrintStepEnum step) const { return "print step " + std::to_string(int(step)); }
     bool            invalidate_step(PrintStepEnum step)
 		{ return m_state.invalidate(step, this->cancel_callback()); }
     template<typename StepTypeIterator>
@@ -762,14 +783,22 @@ public:
 protected:
 	PrintObjectBaseWithState(PrintType *print, ModelObject *model_object) : PrintObjectBase(model_object), m_print(print) {}
 
-    bool            set_started(PrintObjectStepEnum step) 
-        { return m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); }); }
-	PrintStateBase::TimeStamp set_done(PrintObjectStepEnum step) { 
+    bool            set_started(PrintObjectStepEnum step) {
+        bool started = m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (started && StepProfiler::enabled())
+            StepProfiler::step_started(this->profile_step_name(step));
+        return started;
+    }
+	PrintStateBase::TimeStamp set_done(PrintObjectStepEnum step) {
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (StepProfiler::enabled())
+            StepProfiler::step_finished(this->profile_step_name(step));
         if (status.second)
             this->status_update_warnings(m_print, static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
         return status.first;
 	}
+    // Name of the milestone shown in the opt-in step profiler traces.
+    virtual std::string profile_step_name(PrintObjectStepEnum step) const { return "object step " + std::to_string(int(step)); }
 
     bool            invalidate_step(PrintObjectStepEnum step)
         { return m_state.invalidate(step, PrintObjectBase::cancel_callback(m_print)); }
@@ -5913,6 +5913,19 @@ CLIMiscConfigDef::CLIMiscConfigDef()
         "For example. loglevel=2 logs fatal, error and warning level messages.");
     def->min = 0;
 
+    def = this->add("slicing_jobs", coInt);
+    def->label = L("Number of plates sliced concurrently");
+    def->tooltip = L("Slice up to the given number of independent plates (input files) concurrently in one process "
+        "and write each G-code as soon as its plate finishes. The plates share the thread pool, so a value "
+        "above one pays off on many-core machines slicing batches of small plates. Defaults to 1.");
+    def->min = 1;
+
+    def = this->add("batch", coBool);
+    def->label = L("Batch slicing mode");
+    def->tooltip = L("Keep the process running after the command line job finishes and accept further slicing jobs "
+        "on the standard input, one job per line with the same syntax as the command line arguments. "
+        "Avoids paying the process startup overhead for every job and reuses repeatedly loaded models between jobs.");
+
 #ifdef SLIC3R_GUI
     def = this->add("opengl-aa", coBool);
     def->label = L("Automatic OpenGL antialiasing samples number selection");
@@ -45,6 +45,7 @@
 #include <stdint.h>
 #include <boost/container_hash/hash.hpp>
 #include <cereal/cereal.hpp>
+#include <ankerl/unordered_dense.h>
 #include <algorithm>
 #include <initializer_list>
 #include <map>
@@ -413,7 +414,9 @@ protected:
         }
 
     protected:
-        std::map<std::string, ptrdiff_t>    m_map_name_to_offset;
+        // Hash map for O(1) lookups - optptr() runs for every option of every
+        // config apply/diff during the slicing and the g-code generation.
+        ankerl::unordered_dense::map<std::string, ptrdiff_t> m_map_name_to_offset;
     };
 
     // Parametrized by the type of the topmost class owning the options.
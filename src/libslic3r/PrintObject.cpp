@@ -12,9 +12,11 @@
 #include <oneapi/tbb/parallel_for.h>
 #include <boost/log/trivial.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <functional>
 #include <map>
+#include <numeric>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -165,6 +167,13 @@ std::vector<std::reference_wrapper<const PrintRegion>> PrintObject::all_regions(
     return out;
 }
 
+std::string PrintObject::profile_step_name(PrintObjectStep step) const
+{
+    static constexpr const char* names[posCount] = { "slice", "perimeters", "prepare_infill", "infill", "ironing",
+        "support_spots_search", "support_material", "estimate_curled_extrusions", "calculate_overhanging_perimeters" };
+    return std::string(names[step]) + " " + this->model_object()->name;
+}
+
 // 1) Merges typed region slices into stInternal type.
 // 2) Increases an "extra perimeters" counter at region slices where needed.
 // 3) Generates perimeters, gap fills and fill regions (fill regions of type stInternal).
@@ -262,19 +271,41 @@ void PrintObject::make_perimeters()
     }
 
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
+    // Per-layer perimeter cost varies by orders of magnitude (dense bottom layers with many
+    // islands vs. trivial top layers). Schedule the layers by decreasing slice complexity with
+    // single-layer grains, so TBB's work stealing balances the load: with contiguous ranges a
+    // run of expensive layers inside one chunk serializes the tail of the pass.
+    std::vector<size_t> layer_order(m_layers.size());
+    std::iota(layer_order.begin(), layer_order.end(), size_t(0));
+    // Layers inside the priority Z window (the layers the user is currently looking at,
+    // see Print::set_priority_z_window()) go first, then everything by decreasing cost.
+    const auto [priority_z_min, priority_z_max] = m_print->priority_z_window();
+    auto in_priority_window = [priority_z_min = priority_z_min, priority_z_max = priority_z_max](const Layer *layer) {
+        return layer->print_z >= priority_z_min && layer->print_z <= priority_z_max;
+    };
+    std::stable_sort(layer_order.begin(), layer_order.end(), [this, &in_priority_window](size_t l, size_t r) {
+        const bool lp = in_priority_window(m_layers[l]);
+        const bool rp = in_priority_window(m_layers[r]);
+        if (lp != rp)
+            return lp;
+        return count_points(m_layers[l]->lslices) > count_points(m_layers[r]->lslices);
+    });
     tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, m_layers.size()),
-        [this](const tbb::blocked_range<size_t>& range) {
+        tbb::blocked_range<size_t>(0, m_layers.size(), 1),
+        [this, &layer_order](const tbb::blocked_range<size_t>& range) {
             PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
-            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+            for (size_t order_idx = range.begin(); order_idx < range.end(); ++ order_idx) {
                 m_print->throw_if_canceled();
-                m_layers[layer_idx]->make_perimeters();
+                m_layers[layer_order[order_idx]]->make_perimeters();
             }
-        }
+        },
+        tbb::simple_partitioner{}
     );
     m_print->throw_if_canceled();
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - end";
 
+    this->simplify_extrusion_paths(true, false);
+
     this->set_done(posPerimeters);
 }
 
@@ -460,6 +491,7 @@ void PrintObject::infill()
         );
         m_print->throw_if_canceled();
         BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - end";
+        this->simplify_extrusion_paths(false, true);
         /*  we could free memory now, but this would make this step not idempotent
         ### $_->fill_surfaces->clear for map @{$_->regions}, @{$object->layers};
         */
@@ -467,6 +499,40 @@ void PrintObject::infill()
     }
 }
 
+void PrintObject::simplify_extrusion_paths(const bool simplify_perimeters, const bool simplify_fills)
+{
+    // Decimating to the G-code resolution: segments finer than that cannot be executed
+    // by the printer anyway, they only inflate the G-code and stall the firmware planner.
+    const double scaled_resolution = scaled<double>(this->print()->config().gcode_resolution.value);
+    if (scaled_resolution <= 0.)
+        return;
+
+    BOOST_LOG_TRIVIAL(debug) << "Simplifying extrusion paths in parallel - start";
+    std::atomic<size_t> removed_vertices_total{ 0 };
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, m_layers.size()),
+        [this, scaled_resolution, simplify_perimeters, simplify_fills, &removed_vertices_total](const tbb::blocked_range<size_t>& range) {
+            PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
+            size_t removed_vertices = 0;
+            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                m_print->throw_if_canceled();
+                for (LayerRegion *layerm : m_layers[layer_idx]->regions()) {
+                    if (simplify_perimeters) {
+                        removed_vertices += layerm->m_perimeters.simplify(scaled_resolution);
+                        removed_vertices += layerm->m_thin_fills.simplify(scaled_resolution);
+                    }
+                    if (simplify_fills)
+                        removed_vertices += layerm->m_fills.simplify(scaled_resolution);
+                }
+            }
+            removed_vertices_total.fetch_add(removed_vertices, std::memory_order_relaxed);
+        }
+    );
+    m_print->throw_if_canceled();
+    BOOST_LOG_TRIVIAL(debug) << "Simplifying extrusion paths in parallel - end ("
+                             << removed_vertices_total.load() << " vertices removed)";
+}
+
 void PrintObject::ironing()
 {
     if (this->set_started(posIroning)) {
@@ -617,7 +683,7 @@ void PrintObject::calculate_overhanging_perimeters()
 }
 
 std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare_adaptive_infill_data(
-    const std::vector<std::pair<const Surface *, float>> &surfaces_w_bottom_z) const
+    const std::vector<std::pair<const Surface *, float>> &surfaces_w_bottom_z)
 {
     using namespace FillAdaptive;
 
@@ -628,7 +694,39 @@ std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare
     indexed_triangle_set mesh = this->model_object()->raw_indexed_triangle_set();
     // Rotate mesh and build octree on it with axis-aligned (standart base) cubes.
     auto to_octree = transform_to_octree().toRotationMatrix();
-    its_transform(mesh, to_octree * this->trafo_centered(), true);
+    const Transform3d octree_trafo = to_octree * this->trafo_centered();
+
+    // Fingerprint everything the octrees are built from: the source mesh, its transformation into the
+    // octree coordinate space, the cube spacings and the internal bridge overhangs. Hashing the mesh is
+    // orders of magnitude cheaper than rebuilding the octrees from it, which lets re-slices triggered by
+    // mere parameter edits reuse the octrees of the previous run.
+    size_t fingerprint = 0xcbf29ce484222325; // FNV-1a
+    auto hash_bytes = [&fingerprint](const void *data, size_t size) {
+        for (const unsigned char *p = static_cast<const unsigned char*>(data); size > 0; ++ p, -- size)
+            fingerprint = (fingerprint ^ *p) * 0x100000001b3;
+    };
+    hash_bytes(mesh.vertices.data(), mesh.vertices.size() * sizeof(stl_vertex));
+    hash_bytes(mesh.indices.data(), mesh.indices.size() * sizeof(stl_triangle_vertex_indices));
+    hash_bytes(octree_trafo.matrix().data(), octree_trafo.matrix().size() * sizeof(double));
+    hash_bytes(&adaptive_line_spacing, sizeof(adaptive_line_spacing));
+    hash_bytes(&support_line_spacing, sizeof(support_line_spacing));
+    for (const std::pair<const Surface *, float> &surface_w_bottom_z : surfaces_w_bottom_z) {
+        const ExPolygon &expolygon = surface_w_bottom_z.first->expolygon;
+        hash_bytes(expolygon.contour.points.data(), expolygon.contour.points.size() * sizeof(Point));
+        for (const Polygon &hole : expolygon.holes)
+            hash_bytes(hole.points.data(), hole.points.size() * sizeof(Point));
+        hash_bytes(&surface_w_bottom_z.second, sizeof(float));
+    }
+    if (fingerprint == m_adaptive_fill_octrees_hash &&
+        (m_adaptive_fill_octrees.first  != nullptr) == (adaptive_line_spacing != 0.) &&
+        (m_adaptive_fill_octrees.second != nullptr) == (support_line_spacing  != 0.))
+        // Nothing the octrees depend on changed since the last run, reuse them.
+        return std::move(m_adaptive_fill_octrees);
+    // Invalidate the fingerprint while building, it is only stored again once the build finished
+    // without being canceled.
+    m_adaptive_fill_octrees_hash = 0;
+
+    its_transform(mesh, octree_trafo, true);
 
     // Triangulate internal bridging surfaces.
     std::vector<std::vector<Vec3d>> overhangs(std::max(surfaces_w_bottom_z.size(), size_t(1)));
@@ -649,9 +747,11 @@ std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare
     for (size_t i = 1; i < overhangs.size(); ++ i)
         append(overhangs.front(), std::move(overhangs[i]));
 
-    return std::make_pair(
+    auto octrees = std::make_pair(
         adaptive_line_spacing ? build_octree(mesh, overhangs.front(), adaptive_line_spacing, false) : OctreePtr(),
         support_line_spacing  ? build_octree(mesh, overhangs.front(), support_line_spacing, true) : OctreePtr());
+    m_adaptive_fill_octrees_hash = fingerprint;
+    return octrees;
 }
 
 FillLightning::GeneratorPtr PrintObject::prepare_lightning_infill_data()
@@ -1448,6 +1548,10 @@ void PrintObject::discover_vertical_shells()
                         // Bottom surfaces.
                         cache.bottom_surfaces = offset(layerm.slices().filter_by_types(surfaces_bottom), top_bottom_expansion);
 //                        append(cache.bottom_surfaces, offset(layerm.fill_surfaces().filter_by_types(surfaces_bottom), top_bottom_expansion));
+                        // Save some computing time by reducing the number of polygons: The cache entries are traversed
+                        // repeatedly by the following projection pass, once for each neighbor layer inside the shell thickness.
+                        cache.top_surfaces    = union_(cache.top_surfaces);
+                        cache.bottom_surfaces = union_(cache.bottom_surfaces);
                         // Holes over all regions. Only collect them once, they are valid for all region_id iterations.
                         if (cache.holes.empty()) {
                             for (size_t region_id = 0; region_id < layer.regions().size(); ++ region_id)
@@ -1492,6 +1596,12 @@ void PrintObject::discover_vertical_shells()
                     ExPolygons shell_ex;
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
                     float min_perimeter_infill_spacing = float(infill_line_spacing) * 1.05f;
+                    // The shell region will be trimmed by the internal & internal void surfaces. If there are none
+                    // on this layer, the projection of the neighbor layers would be thrown away anyway,
+                    // thus skip gathering it altogether.
+                    const Polygons polygonsInternal = to_polygons(layerm->fill_surfaces().filter_by_types({ stInternal, stInternalVoid, stInternalSolid }));
+                    if (polygonsInternal.empty())
+                        continue;
 #if 0
 // #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
                     {
@@ -1650,7 +1760,6 @@ void PrintObject::discover_vertical_shells()
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
 
                     // Trim the shells region by the internal & internal void surfaces.
-                    const Polygons    polygonsInternal = to_polygons(layerm->fill_surfaces().filter_by_types({ stInternal, stInternalVoid, stInternalSolid }));
                     shell = intersection(shell, polygonsInternal, ApplySafetyOffset::Yes);
                     polygons_append(shell, diff(polygonsInternal, holes));
                     if (shell.empty())
@@ -5,8 +5,10 @@
 #include <boost/log/trivial.hpp>
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/partitioner.h>
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -70,11 +72,14 @@ LayerPtrs new_layers(
 }
 
 // Slice single triangle mesh.
+// If cache is provided, layers with Z values cached from a previous slicing of the same volume
+// with the same parameters are reused and the cache is refreshed with the produced result.
 static std::vector<ExPolygons> slice_volume(
     const ModelVolume             &volume,
-    const std::vector<float>      &zs, 
+    const std::vector<float>      &zs,
     const MeshSlicingParamsEx     &params,
-    const std::function<void()>   &throw_on_cancel_callback)
+    const std::function<void()>   &throw_on_cancel_callback,
+    MeshSliceCache                *cache = nullptr)
 {
     std::vector<ExPolygons> layers;
     if (! zs.empty()) {
@@ -84,7 +89,9 @@ static std::vector<ExPolygons> slice_volume(
             params2.trafo = params2.trafo * volume.get_matrix();
             if (params2.trafo.rotation().determinant() < 0.)
                 its_flip_triangles(its);
-            layers = slice_mesh_ex(its, zs, params2, throw_on_cancel_callback);
+            layers = cache ?
+                slice_mesh_ex(its, zs, params2, *cache, throw_on_cancel_callback) :
+                slice_mesh_ex(its, zs, params2, throw_on_cancel_callback);
             throw_on_cancel_callback();
         }
     }
@@ -98,13 +105,14 @@ static std::vector<ExPolygons> slice_volume(
     const std::vector<float>                    &z,
     const std::vector<t_layer_height_range>     &ranges,
     const MeshSlicingParamsEx                   &params,
-    const std::function<void()>                 &throw_on_cancel_callback)
+    const std::function<void()>                 &throw_on_cancel_callback,
+    MeshSliceCache                              *cache = nullptr)
 {
     std::vector<ExPolygons> out;
     if (! z.empty() && ! ranges.empty()) {
         if (ranges.size() == 1 && z.front() >= ranges.front().first && z.back() < ranges.front().second) {
             // All layers fit into a single range.
-            out = slice_volume(volume, z, params, throw_on_cancel_callback);
+            out = slice_volume(volume, z, params, throw_on_cancel_callback, cache);
         } else {
             std::vector<float>                     z_filtered;
             std::vector<std::pair<size_t, size_t>> n_filtered;
@@ -120,7 +128,7 @@ static std::vector<ExPolygons> slice_volume(
                     n_filtered.emplace_back(std::make_pair(first, i));
             }
             if (! n_filtered.empty()) {
-                std::vector<ExPolygons> layers = slice_volume(volume, z_filtered, params, throw_on_cancel_callback);
+                std::vector<ExPolygons> layers = slice_volume(volume, z_filtered, params, throw_on_cancel_callback, cache);
                 out.assign(z.size(), ExPolygons());
                 i = 0;
                 for (const std::pair<size_t, size_t> &span : n_filtered)
@@ -155,7 +163,9 @@ static std::vector<VolumeSlices> slice_volumes_inner(
     ModelVolumePtrs                                           model_volumes,
     const std::vector<PrintObjectRegions::LayerRangeRegions> &layer_ranges,
     const std::vector<float>                                 &zs,
-    const std::function<void()>                              &throw_on_cancel_callback)
+    const std::function<void()>                              &throw_on_cancel_callback,
+    // Per-volume caches of the previous slicing result, incremental re-slicing when just the Z vector changed.
+    std::map<ObjectID, MeshSliceCache>                       *volume_slice_caches = nullptr)
 {
     model_volumes_sort_by_id(model_volumes);
 
@@ -189,6 +199,7 @@ static std::vector<VolumeSlices> slice_volumes_inner(
             MeshSlicingParamsEx params { params_base };
             if (! model_volume->is_negative_volume())
                 params.extra_offset = extra_offset;
+            MeshSliceCache *cache = volume_slice_caches == nullptr ? nullptr : &(*volume_slice_caches)[model_volume->id()];
             if (layer_ranges.size() == 1) {
                 if (const PrintObjectRegions::LayerRangeRegions &layer_range = layer_ranges.front(); layer_range.has_volume(model_volume->id())) {
                     if (model_volume->is_model_part() && print_config.spiral_vase) {
@@ -203,8 +214,8 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                             ++ params.slicing_mode_normal_below_layer);
                     }
                     out.push_back({
-                        model_volume->id(), 
-                        slice_volume(*model_volume, zs, params, throw_on_cancel_callback)
+                        model_volume->id(),
+                        slice_volume(*model_volume, zs, params, throw_on_cancel_callback, cache)
                     });
                 }
             } else {
@@ -214,9 +225,9 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                     if (layer_range.has_volume(model_volume->id()))
                         slicing_ranges.emplace_back(layer_range.layer_height_range);
                 if (! slicing_ranges.empty())
-                    out.push_back({ 
-                        model_volume->id(), 
-                        slice_volume(*model_volume, zs, slicing_ranges, params, throw_on_cancel_callback)
+                    out.push_back({
+                        model_volume->id(),
+                        slice_volume(*model_volume, zs, slicing_ranges, params, throw_on_cancel_callback, cache)
                     });
             }
             if (! out.empty() && out.back().slices.empty())
@@ -549,6 +560,11 @@ void PrintObject::slice()
     if (! warning.empty())
         BOOST_LOG_TRIVIAL(info) << warning;
 #endif
+    // The two passes below iterate over the same layers back to back. Sharing one affinity
+    // partitioner replays the layer ranges on the workers that touched them in the previous
+    // pass, so the Z graph pass reads lslices while they are still warm in the local cache
+    // (and on the local NUMA node on multi-socket machines).
+    tbb::affinity_partitioner slice_partitioner;
     // Update bounding boxes, back up raw slices of complex models.
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, m_layers.size()),
@@ -562,7 +578,8 @@ void PrintObject::slice()
                 	layer.lslices_ex.push_back({ get_extents(expoly) });
                 layer.backup_untyped_slices();
             }
-        });
+        },
+        slice_partitioner);
     // Interlink the lslices into a Z graph.
     tbb::parallel_for(
         tbb::blocked_range<size_t>(1, m_layers.size()),
@@ -571,7 +588,8 @@ void PrintObject::slice()
                 m_print->throw_if_canceled();
                 Layer::build_up_down_graph(*m_layers[layer_idx - 1], *m_layers[layer_idx]);
             }
-        });
+        },
+        slice_partitioner);
     if (m_layers.empty())
         throw Slic3r::SlicingError("No layers were detected. You might want to repair your STL file(s) or check their size or thickness and retry.\n");    
     this->set_done(posSlice);
@@ -866,11 +884,20 @@ void PrintObject::slice_volumes()
             layer->m_regions.emplace_back(new LayerRegion(layer, pr.get()));
     }
 
+    // Drop slice caches of volumes that no longer exist in the model object.
+    for (auto it = m_volume_slice_caches.begin(); it != m_volume_slice_caches.end();)
+        if (std::none_of(this->model_object()->volumes.begin(), this->model_object()->volumes.end(),
+                [&it](const ModelVolume *v) { return v->id() == it->first; }))
+            it = m_volume_slice_caches.erase(it);
+        else
+            ++ it;
+
     std::vector<float>                   slice_zs      = zs_from_layers(m_layers);
     std::vector<std::vector<ExPolygons>> region_slices = slices_to_regions(this->model_object()->volumes, *m_shared_regions, slice_zs,
         slice_volumes_inner(
             print->config(), this->config(), this->trafo_centered(),
-            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, throw_on_cancel_callback),
+            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, throw_on_cancel_callback,
+            &m_volume_slice_caches),
         throw_on_cancel_callback);
 
     for (size_t region_id = 0; region_id < region_slices.size(); ++ region_id) {
@@ -459,41 +459,28 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
     int status_offset = 0;
     TriangleInfos t_infos(its.indices.size());
     VertexInfos   v_infos(its.vertices.size());
-    {
-        std::vector<SymMat> triangle_quadrics(its.indices.size());
-        // calculate normals
-        tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
-        [&](const tbb::blocked_range<size_t> &range) {
-            for (size_t i = range.begin(); i < range.end(); ++i) {
-                const Triangle &t      = its.indices[i];
-                TriangleInfo &  t_info = t_infos[i];
-                Vec3d           normal = create_normal(t, its.vertices);
-                t_info.n = normal.cast<float>();
-                triangle_quadrics[i] = create_quadric(t, normal, its.vertices);
-                if (i % 1000000 == 0) {
-                    throw_on_cancel();
-                    status_fn(status_offset + (i * status_normal_size) / its.indices.size());
-                }
-            }
-        }); // END parallel for
-        status_offset += status_normal_size;
-
-        // sum quadrics
-        for (size_t i = 0; i < its.indices.size(); i++) {
-            const Triangle &t = its.indices[i];
-            const SymMat &  q = triangle_quadrics[i];
-            for (size_t e = 0; e < 3; e++) {
-                VertexInfo &v_info = v_infos[t[e]];
-                v_info.q += q;
-                ++v_info.count; // triangle count
-            }
+    std::vector<SymMat> triangle_quadrics(its.indices.size());
+    // calculate normals
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            const Triangle &t      = its.indices[i];
+            TriangleInfo &  t_info = t_infos[i];
+            Vec3d           normal = create_normal(t, its.vertices);
+            t_info.n = normal.cast<float>();
+            triangle_quadrics[i] = create_quadric(t, normal, its.vertices);
             if (i % 1000000 == 0) {
                 throw_on_cancel();
-                status_fn(status_offset + (i * status_sum_quadric) / its.indices.size());
+                status_fn(status_offset + (i * status_normal_size) / its.indices.size());
             }
         }
-        status_offset += status_sum_quadric;
-    } // remove triangle quadrics
+    }); // END parallel for
+    status_offset += status_normal_size;
+
+    // count triangles surrounding each vertex
+    for (const Triangle &t : its.indices)
+        for (size_t e = 0; e < 3; e++)
+            ++v_infos[t[e]].count;
 
     // set offseted starts
     uint32_t triangle_start = 0;
@@ -509,28 +496,10 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
     throw_on_cancel();
     status_fn(status_offset);
 
-    // calc error
-    Errors errors(its.indices.size());
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
-    [&](const tbb::blocked_range<size_t> &range) {
-        for (size_t i = range.begin(); i < range.end(); ++i) {
-            const Triangle &t      = its.indices[i];
-            TriangleInfo &  t_info = t_infos[i];
-            errors[i] = calculate_error(i, t, its.vertices, v_infos, t_info.min_index);
-            if (i % 1000000 == 0) {
-                throw_on_cancel();
-                status_fn(status_offset + (i * status_calc_errors) / its.indices.size());
-            }
-            if (i % 1000000 == 0) throw_on_cancel();
-        }
-    }); // END parallel for
-
-    status_offset += status_calc_errors;
-    
     // create reference
     EdgeInfos e_infos(its.indices.size() * 3);
     for (size_t i = 0; i < its.indices.size(); i++) {
-        const Triangle &t = its.indices[i];       
+        const Triangle &t = its.indices[i];
         for (size_t j = 0; j < 3; ++j) {
             VertexInfo &v_info = v_infos[t[j]];
             size_t ei = v_info.start + v_info.count;
@@ -545,6 +514,44 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
             status_fn(status_offset + (i * status_create_refs) / its.indices.size());
         }
     }
+    status_offset += status_create_refs;
+
+    // sum quadrics
+    // With the vertex -> triangle references in place the per-vertex quadrics become
+    // an independent gather over the surrounding triangles, unlike the former serial
+    // scatter over triangles which wrote three shared vertices per step.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, v_infos.size()),
+    [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t vi = range.begin(); vi < range.end(); ++vi) {
+            VertexInfo &v_info = v_infos[vi];
+            uint32_t e_info_end = v_info.start + v_info.count;
+            for (uint32_t ei = v_info.start; ei < e_info_end; ++ei)
+                v_info.q += triangle_quadrics[e_infos[ei].t_index];
+            if (vi % 1000000 == 0) {
+                throw_on_cancel();
+                status_fn(status_offset + (vi * status_sum_quadric) / v_infos.size());
+            }
+        }
+    }); // END parallel for
+    triangle_quadrics.clear();
+    triangle_quadrics.shrink_to_fit();
+    status_offset += status_sum_quadric;
+
+    // calc error
+    Errors errors(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            const Triangle &t      = its.indices[i];
+            TriangleInfo &  t_info = t_infos[i];
+            errors[i] = calculate_error(i, t, its.vertices, v_infos, t_info.min_index);
+            if (i % 1000000 == 0) {
+                throw_on_cancel();
+                status_fn(status_offset + (i * status_calc_errors) / its.indices.size());
+            }
+            if (i % 1000000 == 0) throw_on_cancel();
+        }
+    }); // END parallel for
 
     throw_on_cancel();
     status_fn(100);
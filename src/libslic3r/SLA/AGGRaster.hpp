@@ -62,6 +62,8 @@ protected:
     Trafo m_trafo;
     Scanline m_scanlines;
     Rasterizer m_rasterizer;
+
+    TColor m_background;
     
     void flipy(agg::path_storage &path) const
     {
@@ -143,6 +145,7 @@ public:
         , m_raw_renderer(m_pixrenderer)
         , m_renderer(m_raw_renderer)
         , m_trafo(trafo)
+        , m_background(background)
     {
         // Visual Studio compiler gives warnings about possible division by zero.
         assert(pd.w_mm != 0 && pd.h_mm != 0);
@@ -165,7 +168,9 @@ public:
     }
     
     void draw(const ExPolygon &poly) override { _draw(poly); }
-    
+
+    void reset() override { clear(m_background); }
+
     EncodedRaster encode(RasterEncoder encoder) const override
     {
         return encoder(m_buf.data(), m_resolution.width_px, m_resolution.height_px, 1);    
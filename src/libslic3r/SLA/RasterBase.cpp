@@ -25,8 +25,9 @@ EncodedRaster PNGRasterEncoder::operator()(const void *ptr, size_t w, size_t h,
     std::vector<uint8_t> buf;
     size_t s = 0;
     
-    void *rawdata = tdefl_write_image_to_png_file_in_memory(
-        ptr, int(w), int(h), int(num_components), &s);
+    void *rawdata = tdefl_write_image_to_png_file_in_memory_ex(
+        ptr, int(w), int(h), int(num_components), &s, compression_level,
+        MZ_FALSE);
     
     // On error, data() will return an empty vector. No other info can be
     // retrieved from miniz anyway...
@@ -98,6 +98,9 @@ public:
     
     /// Draw a polygon with holes.
     virtual void draw(const ExPolygon& poly) = 0;
+
+    /// Clear the canvas, so that the raster instance can be reused for another layer.
+    virtual void reset() = 0;
     
     /// Get the resolution of the raster.
 //    virtual Resolution resolution() const = 0;
@@ -108,6 +111,10 @@ public:
 };
 
 struct PNGRasterEncoder {
+    // Zlib compression level 0..10 as interpreted by miniz, the default
+    // matches MZ_DEFAULT_LEVEL used before the level became adjustable.
+    int compression_level = 6;
+
     EncodedRaster operator()(const void *ptr, size_t w, size_t h, size_t num_components);
 };
 
@@ -106,10 +106,12 @@ ExPolygons merged_layer(const DepthMapLayer &dlayer)
 
 std::vector<ExPolygons> depthmap_to_slices(const DepthMap &dm)
 {
-    auto out = reserve_vector<ExPolygons>(dm.size());
-    for (const auto &dlayer : dm) {
-        out.emplace_back(merged_layer(dlayer));
-    }
+    std::vector<ExPolygons> out(dm.size());
+
+    execution::for_each(ex_tbb, size_t{0}, dm.size(),
+        [&out, &dm] (size_t lyr) {
+            out[lyr] = merged_layer(dm[lyr]);
+        }, execution::max_concurrency(ex_tbb));
 
     return out;
 }
@@ -723,6 +723,12 @@ bool SLAPrint::is_prusa_print(const std::string& printer_model)
     return false;
 }
 
+std::string SLAPrint::profile_step_name(SLAPrintStep step) const
+{
+    static constexpr const char* names[slapsCount] = { "merge_slices_and_eval", "rasterize" };
+    return names[step];
+}
+
 bool SLAPrint::invalidate_step(SLAPrintStep step)
 {
     bool invalidated = Inherited::invalidate_step(step);
@@ -1015,11 +1021,16 @@ bool SLAPrintObject::invalidate_state_by_config_options(const std::vector<t_conf
         } else if (
                opt_key == "support_points_density_relative"
             || opt_key == "support_enforcers_only"
+            // Head front diameter defines the sampling distances on islands and
+            // the head radius stored with each generated support point, so the
+            // sampling pass has to be re-run. The island graph prepared in
+            // slaposObjectSlice stays valid, only the cheap sampling repeats.
+            || opt_key == "support_head_front_diameter"
+            || opt_key == "branchingsupport_head_front_diameter"
             ) {
             steps.emplace_back(slaposSupportPoints);
         } else if (
-               opt_key == "support_head_front_diameter"
-            || opt_key == "support_head_penetration"
+               opt_key == "support_head_penetration"
             || opt_key == "support_head_width"
             || opt_key == "support_pillar_diameter"
             || opt_key == "support_pillar_widening_factor"
@@ -1034,7 +1045,6 @@ bool SLAPrintObject::invalidate_state_by_config_options(const std::vector<t_conf
             || opt_key == "support_max_bridge_length"
             || opt_key == "support_max_pillar_link_distance"
             || opt_key == "support_base_safety_distance"
-            || opt_key == "branchingsupport_head_front_diameter"
             || opt_key == "branchingsupport_head_penetration"
             || opt_key == "branchingsupport_head_width"
             || opt_key == "branchingsupport_pillar_diameter"
@@ -1076,6 +1086,13 @@ bool SLAPrintObject::invalidate_state_by_config_options(const std::vector<t_conf
     return invalidated;
 }
 
+std::string SLAPrintObject::profile_step_name(SLAPrintObjectStep step) const
+{
+    static constexpr const char* names[slaposCount] = { "assembly", "hollowing", "drill_holes", "object_slice",
+        "support_points", "support_tree", "pad", "slice_supports" };
+    return std::string(names[step]) + " " + this->model_object()->name;
+}
+
 bool SLAPrintObject::invalidate_step(SLAPrintObjectStep step)
 {
     bool invalidated = Inherited::invalidate_step(step);
@@ -1334,6 +1351,16 @@ MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartForStep &part)
     return part.cgalcache? clone(*part.cgalcache) : nullptr;
 }
 
+std::optional<bool> get_cached_validity(const CSGPartForStep &part)
+{
+    return part.validcache;
+}
+
+void set_cached_validity(const CSGPartForStep &part, bool valid)
+{
+    part.validcache = valid;
+}
+
 } // namespace csg
 
 } // namespace Slic3r
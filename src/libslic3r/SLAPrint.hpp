@@ -19,6 +19,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -94,6 +95,8 @@ struct CSGPartForStep : public csg::CSGPart
 {
     SLAPrintObjectStep key;
     mutable MeshBoolean::cgal::CGALMeshPtr cgalcache;
+    // Caches the verdict of csg::check_csgmesh_booleans() for this part.
+    mutable std::optional<bool> validcache;
 
     CSGPartForStep(SLAPrintObjectStep k, CSGPart &&p = {})
         : key{k}, CSGPart{std::move(p)}
@@ -113,6 +116,8 @@ struct CSGPartForStep : public csg::CSGPart
 namespace csg {
 
 MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartForStep &part);
+std::optional<bool> get_cached_validity(const CSGPartForStep &part);
+void set_cached_validity(const CSGPartForStep &part, bool valid);
 
 } // namespace csg
 
@@ -348,6 +353,8 @@ protected:
     // Invalidate steps based on a set of parameters changed.
     bool                    invalidate_state_by_config_options(const std::vector<t_config_option_key> &opt_keys);
 
+    std::string             profile_step_name(SLAPrintObjectStep step) const override;
+
 private:
     // Object specific configuration, pulled from the configuration layer.
     SLAPrintObjectConfig                    m_config;
@@ -597,6 +604,8 @@ private:
     // Invalidate steps based on a set of parameters changed.
     bool invalidate_state_by_config_options(const std::vector<t_config_option_key> &opt_keys, bool &invalidate_all_model_objects);
 
+    std::string profile_step_name(SLAPrintStep step) const override;
+
     SLAPrintConfig                  m_print_config;
     SLAPrinterConfig                m_printer_config;
     SLAMaterialConfig               m_material_config;
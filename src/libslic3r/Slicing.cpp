@@ -244,12 +244,16 @@ std::vector<coordf_t> layer_height_profile_from_ranges(
 // Fill layer_height_profile by heights ensuring a prescribed maximum cusp height.
 std::vector<double> layer_height_profile_adaptive(const SlicingParameters& slicing_params, const ModelObject& object, float quality_factor)
 {
-    // 1) Initialize the SlicingAdaptive class with the object meshes.
+    // Initialize the SlicingAdaptive class with the object meshes.
     SlicingAdaptive as;
     as.set_slicing_parameters(slicing_params);
     as.prepare(object);
+    return layer_height_profile_adaptive(slicing_params, as, quality_factor);
+}
 
-    // 2) Generate layers using the algorithm of @platsch 
+std::vector<double> layer_height_profile_adaptive(const SlicingParameters& slicing_params, SlicingAdaptive& as, float quality_factor)
+{
+    // Generate layers using the algorithm of @platsch
     std::vector<double> layer_height_profile;
     layer_height_profile.push_back(0.0);
     layer_height_profile.push_back(slicing_params.first_object_layer_height);
@@ -158,6 +158,13 @@ std::vector<double> layer_height_profile_adaptive(
     const SlicingParameters& slicing_params,
     const ModelObject& object, float quality_factor);
 
+// Variant reusing an already prepared SlicingAdaptive instance, which caches the per-facet
+// slope data between calls (used by the GUI for the adaptive quality slider).
+class SlicingAdaptive;
+std::vector<double> layer_height_profile_adaptive(
+    const SlicingParameters& slicing_params,
+    SlicingAdaptive& slicing_adaptive, float quality_factor);
+
 struct HeightProfileSmoothingParams
 {
     unsigned int radius;
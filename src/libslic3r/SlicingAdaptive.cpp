@@ -85,10 +85,28 @@ void SlicingAdaptive::clear()
 
 void SlicingAdaptive::prepare(const ModelObject &object)
 {
+    // The per-facet slope data only depends on the object geometry and the instance transformation,
+    // not on the slicing parameters or the quality factor, thus reuse it if the object has not changed
+    // since the last call. The GUI calls prepare() for every notch of the adaptive quality slider.
+    const ModelInstance &first_instance = *object.instances.front();
+    std::vector<std::pair<ObjectID, Transform3d>> volumes_key;
+    volumes_key.reserve(object.volumes.size());
+    for (const ModelVolume *volume : object.volumes)
+        if (volume->is_model_part())
+            volumes_key.emplace_back(volume->id(), volume->get_matrix());
+    auto same_trafo = [](const Transform3d &l, const Transform3d &r) { return l.matrix() == r.matrix(); };
+    if (! m_faces.empty() && object.id() == m_object_id && same_trafo(first_instance.get_matrix(), m_instance_trafo) &&
+        volumes_key.size() == m_volumes_key.size() &&
+        std::equal(volumes_key.begin(), volumes_key.end(), m_volumes_key.begin(),
+                   [&same_trafo](const auto &l, const auto &r) { return l.first == r.first && same_trafo(l.second, r.second); }))
+        return;
+    m_object_id      = object.id();
+    m_volumes_key    = std::move(volumes_key);
+    m_instance_trafo = first_instance.get_matrix();
+
     this->clear();
 
     TriangleMesh		 mesh			= object.raw_mesh();
-    const ModelInstance &first_instance = *object.instances.front();
     mesh.transform(first_instance.get_matrix(), first_instance.is_left_handed());
 
     // 1) Collect faces from mesh.
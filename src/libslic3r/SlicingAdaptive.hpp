@@ -12,6 +12,8 @@
 #include <vector>
 #include <cstddef>
 
+#include "ObjectID.hpp"
+#include "Point.hpp"
 #include "Slicing.hpp"
 #include "admesh/stl.h"
 
@@ -45,6 +47,12 @@ protected:
 	SlicingParameters 		m_slicing_params;
 
 	std::vector<FaceZ>		m_faces;
+
+	// Identity of the object geometry m_faces was calculated from, to reuse the slope data
+	// between prepare() calls on an unchanged object (see SlicingAdaptive::prepare()).
+	ObjectID										m_object_id;
+	std::vector<std::pair<ObjectID, Transform3d>>	m_volumes_key;
+	Transform3d										m_instance_trafo{ Transform3d::Identity() };
 };
 
 }; // namespace Slic3r
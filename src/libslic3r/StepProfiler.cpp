@@ -0,0 +1,178 @@
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#include "StepProfiler.hpp"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <ctime>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdlib.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include "Utils.hpp"
+
+namespace Slic3r {
+namespace StepProfiler {
+
+namespace {
+
+// CPU time consumed by the calling thread since its start, in microseconds.
+// Compared against the wall clock span of a milestone it hints how much of the work
+// was offloaded to the TBB workers (the worker time is not billed to this thread).
+int64_t thread_cpu_time_us()
+{
+#ifdef _WIN32
+    FILETIME creation, exit_, kernel, user;
+    if (::GetThreadTimes(::GetCurrentThread(), &creation, &exit_, &kernel, &user)) {
+        auto to_us = [](const FILETIME &ft) {
+            return ((int64_t(ft.dwHighDateTime) << 32) + int64_t(ft.dwLowDateTime)) / 10;
+        };
+        return to_us(kernel) + to_us(user);
+    }
+#else
+    struct timespec ts;
+    if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return int64_t(ts.tv_sec) * 1000000 + int64_t(ts.tv_nsec) / 1000;
+#endif
+    return 0;
+}
+
+struct PendingStep
+{
+    int64_t wall_start_us;
+    int64_t cpu_start_us;
+    size_t  rss_start;
+};
+
+struct Event
+{
+    std::string name;
+    size_t      tid;
+    int64_t     ts_us;
+    int64_t     dur_us;
+    int64_t     cpu_us;
+    int64_t     rss_delta;
+};
+
+struct Profiler
+{
+    std::mutex                                      mutex;
+    // Keyed by the step name and the executing thread, as the same step may run
+    // concurrently for multiple print objects.
+    std::unordered_map<std::string, PendingStep>    pending;
+    std::vector<Event>                              events;
+    std::chrono::steady_clock::time_point           start = std::chrono::steady_clock::now();
+
+    int64_t now_us() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->start).count();
+    }
+};
+
+Profiler& profiler()
+{
+    static Profiler instance;
+    return instance;
+}
+
+const char* trace_path()
+{
+    static const char *path = boost::nowide::getenv("SLIC3R_STEP_PROFILE");
+    return path;
+}
+
+size_t this_thread_id()
+{
+    return std::hash<std::thread::id>{}(std::this_thread::get_id());
+}
+
+std::string pending_key(const std::string &name, size_t tid)
+{
+    return name + "/" + std::to_string(tid);
+}
+
+void write_json_escaped(boost::nowide::ofstream &out, const std::string &str)
+{
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+}
+
+} // namespace
+
+bool enabled()
+{
+    const char *path = trace_path();
+    return path != nullptr && *path != 0;
+}
+
+void step_started(const std::string &name)
+{
+    if (! enabled())
+        return;
+    Profiler &p = profiler();
+    PendingStep pending { p.now_us(), thread_cpu_time_us(), current_resident_memory() };
+    std::scoped_lock<std::mutex> lock(p.mutex);
+    p.pending[pending_key(name, this_thread_id())] = pending;
+}
+
+void step_finished(const std::string &name)
+{
+    if (! enabled())
+        return;
+    Profiler     &p        = profiler();
+    const size_t  tid      = this_thread_id();
+    const int64_t wall_end = p.now_us();
+    const int64_t cpu_end  = thread_cpu_time_us();
+    const size_t  rss_end  = current_resident_memory();
+    std::scoped_lock<std::mutex> lock(p.mutex);
+    auto it = p.pending.find(pending_key(name, tid));
+    if (it == p.pending.end())
+        // set_started() of this step was not taken (the step was already done or not enabled).
+        return;
+    p.events.push_back({ name, tid, it->second.wall_start_us, wall_end - it->second.wall_start_us,
+                         cpu_end - it->second.cpu_start_us, int64_t(rss_end) - int64_t(it->second.rss_start) });
+    p.pending.erase(it);
+}
+
+void save()
+{
+    if (! enabled())
+        return;
+    Profiler &p = profiler();
+    std::scoped_lock<std::mutex> lock(p.mutex);
+    boost::nowide::ofstream out(trace_path());
+    if (! out) {
+        BOOST_LOG_TRIVIAL(error) << "StepProfiler: cannot open " << trace_path() << " for writing";
+        return;
+    }
+    out << "{\"traceEvents\":[";
+    for (size_t i = 0; i < p.events.size(); ++ i) {
+        const Event &e = p.events[i];
+        if (i > 0)
+            out << ",";
+        out << "\n{\"name\":\"";
+        write_json_escaped(out, e.name);
+        out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.tid
+            << ",\"ts\":" << e.ts_us << ",\"dur\":" << e.dur_us
+            << ",\"args\":{\"thread_cpu_us\":" << e.cpu_us
+            << ",\"rss_delta_bytes\":" << e.rss_delta << "}}";
+    }
+    out << "\n]}\n";
+    BOOST_LOG_TRIVIAL(info) << "StepProfiler: " << p.events.size() << " steps written to " << trace_path();
+}
+
+} // namespace StepProfiler
+} // namespace Slic3r
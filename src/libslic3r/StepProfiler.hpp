@@ -0,0 +1,33 @@
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
+#ifndef slic3r_StepProfiler_hpp_
+#define slic3r_StepProfiler_hpp_
+
+#include <string>
+
+namespace Slic3r {
+
+// Opt-in profiler of the Print / PrintObject pipeline milestones. When enabled, the wall clock
+// span, the CPU time consumed by the milestone's thread and the resident memory delta of each
+// executed step are recorded, and Print::export_gcode() dumps the records in the chrome://tracing
+// JSON format (open with chrome://tracing or https://ui.perfetto.dev). Intended for capacity
+// planning of slicing services and for hunting pipeline regressions without ad hoc instrumentation.
+namespace StepProfiler {
+
+// The profiler is enabled by pointing the SLIC3R_STEP_PROFILE environment variable
+// to the path of the trace file to be written.
+bool enabled();
+
+// To be called when a milestone enters the Started resp. the Done state. The milestone executes
+// between the two calls on the calling thread. Cheap no-ops when the profiler is not enabled.
+void step_started(const std::string &name);
+void step_finished(const std::string &name);
+
+// Write all records collected so far into the file given by SLIC3R_STEP_PROFILE.
+void save();
+
+} // namespace StepProfiler
+
+} // namespace Slic3r
+
+#endif // slic3r_StepProfiler_hpp_
@@ -14,6 +14,7 @@
 #include <atomic>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <utility>
 #include <cinttypes>
@@ -722,12 +723,18 @@ static void organic_smooth_branches_avoid_collisions(
     std::function<void()>                                throw_on_cancel)
 {
     struct LayerCollisionCache {
+        // Unscaled collision outlines of one layer with the AABB tree built over them.
+        // Shared between successive layers with identical collision polygons (prismatic parts),
+        // to keep the memory footprint of the cache bounded on tall objects.
+        struct Geometry {
+            std::vector<Linef> lines;
+            AABBTreeIndirect::Tree<2, double> aabbtree_lines;
+        };
         coord_t          min_element_radius{ std::numeric_limits<coord_t>::max() };
         bool             min_element_radius_known() const { return this->min_element_radius != std::numeric_limits<coord_t>::max(); }
         coord_t          collision_radius{ 0 };
-        std::vector<Linef> lines;
-        AABBTreeIndirect::Tree<2, double> aabbtree_lines;
-        bool             empty() const { return this->lines.empty(); }
+        std::shared_ptr<const Geometry> geometry;
+        bool             empty() const { return ! this->geometry || this->geometry->lines.empty(); }
     };
     std::vector<LayerCollisionCache> layer_collision_cache;
     layer_collision_cache.reserve(1024);
@@ -745,6 +752,8 @@ static void organic_smooth_branches_avoid_collisions(
 
     throw_on_cancel();
 
+    const Polygons                                         *last_collision_polygons = nullptr;
+    std::shared_ptr<const LayerCollisionCache::Geometry>    last_collision_geometry;
     for (LayerIndex layer_idx = 0; layer_idx < LayerIndex(layer_collision_cache.size()); ++layer_idx)
         if (LayerCollisionCache& l = layer_collision_cache[layer_idx]; !l.min_element_radius_known())
             l.min_element_radius = 0;
@@ -754,11 +763,21 @@ static void organic_smooth_branches_avoid_collisions(
             std::optional<std::pair<coord_t, std::reference_wrapper<const Polygons>>> res = volumes.get_collision_lower_bound_area(layer_idx, l.min_element_radius);
             assert(res.has_value());
             l.collision_radius = res->first;
-            Lines alines = to_lines(res->second.get());
-            l.lines.reserve(alines.size());
-            for (const Line &line : alines)
-                l.lines.push_back({ unscaled<double>(line.a), unscaled<double>(line.b) });
-            l.aabbtree_lines = AABBTreeLines::build_aabb_tree_over_indexed_lines(l.lines);
+            const Polygons &collision_polygons = res->second.get();
+            if (last_collision_polygons != nullptr && *last_collision_polygons == collision_polygons) {
+                // Same collision outline as the layer below, share its lines and AABB tree.
+                l.geometry = last_collision_geometry;
+            } else {
+                auto geometry = std::make_shared<LayerCollisionCache::Geometry>();
+                Lines alines = to_lines(collision_polygons);
+                geometry->lines.reserve(alines.size());
+                for (const Line &line : alines)
+                    geometry->lines.push_back({ unscaled<double>(line.a), unscaled<double>(line.b) });
+                geometry->aabbtree_lines = AABBTreeLines::build_aabb_tree_over_indexed_lines(geometry->lines);
+                l.geometry = std::move(geometry);
+                last_collision_polygons = &collision_polygons;
+                last_collision_geometry = l.geometry;
+            }
             throw_on_cancel();
         }
 
@@ -856,7 +875,7 @@ static void organic_smooth_branches_avoid_collisions(
                                 size_t hit_idx_out;
                                 Vec2d  hit_point_out;
                                 if (double dist = sqrt(AABBTreeLines::squared_distance_to_indexed_lines(
-                                    layer_collision_cache_item.lines, layer_collision_cache_item.aabbtree_lines, Vec2d(to_2d(collision_sphere.position).cast<double>()),
+                                    layer_collision_cache_item.geometry->lines, layer_collision_cache_item.geometry->aabbtree_lines, Vec2d(to_2d(collision_sphere.position).cast<double>()),
                                     hit_idx_out, hit_point_out, r2)); dist >= 0.) {
                                     double collision_depth = sqrt(r2) - dist;
                                     if (collision_depth > collision_sphere.last_collision_depth) {
@@ -1872,7 +1872,8 @@ void generate_support_toolpaths(
             }
             assert(support_layer.support_islands.empty());
             if (! polys.empty()) {
-                support_layer.support_islands = union_ex(polys);
+                // The collected islands are mostly disjoint, take the clustering fast path.
+                support_layer.support_islands = union_ex_disjoint(polys);
                 support_layer.support_islands_bboxes.reserve(support_layer.support_islands.size());
                 for (const ExPolygon &expoly : support_layer.support_islands)
                     support_layer.support_islands_bboxes.emplace_back(get_extents(expoly).inflated(SCALED_EPSILON));
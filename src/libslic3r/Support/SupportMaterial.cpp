@@ -1194,6 +1194,9 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
         // Generate overhang / contact_polygons for non-raft layers.
         const Layer &lower_layer  = *layer.lower_layer;
         const bool   has_enforcer = ! annotations.enforcers_layers.empty() && ! annotations.enforcers_layers[layer_id].empty();
+        // With automatic supports disabled, only the enforcers and the first support_material_enforce_layers
+        // layers may produce contact areas, thus the per-region overhang detection may be skipped.
+        const bool   regions_may_produce_overhangs = support_auto || layer_id < (size_t)object_config.support_material_enforce_layers.value;
 
         // Cache support trimming polygons derived from lower layer polygons, possible merged with "on build plate only" trimming polygons.
         auto slices_margin_update = 
@@ -1232,6 +1235,10 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
                     float(scale_(lower_layer.height / tan(threshold_rad))) :
                     // Overhang defined by half the extrusion width.
                     0.5f * fw);
+            if (! regions_may_produce_overhangs)
+                // No contact areas may come out of this region, however lower_layer_offset
+                // calculated above is still used to trim the enforcer contacts below.
+                continue;
             // Overhang polygons for this layer and region.
             Polygons diff_polygons;
             Polygons layerm_polygons = to_polygons(layerm->slices().surfaces);
@@ -1792,6 +1799,11 @@ static inline SupportGeneratorLayer* detect_bottom_contacts(
     if (top.empty())
         return nullptr;
 
+    // Cheap reject before the exact intersection: on tall prints the projected supports
+    // and the top surfaces of most layers do not even share a bounding box.
+    if (! get_extents(top).overlap(get_extents(supports_projected)))
+        return nullptr;
+
     Polygons touching = intersection(top, supports_projected);
     if (touching.empty())
         return nullptr;
@@ -1857,11 +1869,12 @@ static inline SupportGeneratorLayer* detect_bottom_contacts(
     // Trim the already created base layers above the current layer intersecting with the new bottom contacts layer.
     //FIXME Maybe this is no more needed, as the overlapping base layers are trimmed by the bottom layers at the final stage?
     touching = expand(touching, float(SCALED_EPSILON));
+    const BoundingBox touching_bbox = get_extents(touching);
     for (int layer_id_above = layer_id + 1; layer_id_above < int(object.total_layer_count()); ++ layer_id_above) {
         const Layer &layer_above = *object.layers()[layer_id_above];
         if (layer_above.print_z > layer_new.print_z - EPSILON)
             break;
-        if (Polygons &above = layer_support_areas[layer_id_above]; ! above.empty()) {
+        if (Polygons &above = layer_support_areas[layer_id_above]; ! above.empty() && touching_bbox.overlap(get_extents(above))) {
 #ifdef SLIC3R_DEBUG
             SVG::export_expolygons(debug_out_path("support-support-areas-raw-before-trimming-%d-with-%f-%lf.svg", iRun, layer.print_z, layer_above.print_z),
                 { { { union_ex(touching) },              { "touching", "blue", 0.5f } },
@@ -18,6 +18,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <functional>
 #include <map>
@@ -224,24 +225,24 @@ private:
         RadiusLayerPolygonCache& operator=(const RadiusLayerPolygonCache&) = delete;
 
         void insert(std::vector<std::pair<RadiusLayerPair, Polygons>> &&in) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             for (auto &d : in)
                 this->get_allocate_layer_data(d.first.second).emplace(d.first.first, std::move(d.second));
         }
         // by layer
         void insert(std::vector<std::pair<coord_t, Polygons>> &&in, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             for (auto &d : in)
                 this->get_allocate_layer_data(d.first).emplace(radius, std::move(d.second));
         }
         void insert(std::vector<Polygons> &&in, coord_t first_layer_idx, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             allocate_layers(first_layer_idx + in.size());
             for (auto &d : in)
                 m_data[first_layer_idx ++].emplace(radius, std::move(d));
         }
         void insert(LayerPolygonCache &&in, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::lock_guard<std::shared_mutex> guard(m_mutex);
             LayerIndex i = in.begin();
             allocate_layers(i + LayerIndex(in.size()));
             for (auto &d : in.polygons_mutable())
@@ -253,7 +254,7 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         std::optional<std::reference_wrapper<const Polygons>> getArea(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
 
             if (key.second >= LayerIndex(m_data.size()))
                 return std::nullopt;
@@ -267,7 +268,7 @@ private:
         }
         // Get a collision area at a given layer for a radius that is a lower or equial to the key radius.
         std::optional<std::pair<coord_t, std::reference_wrapper<const Polygons>>> get_lower_bound_area(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
             if (key.second >= LayerIndex(m_data.size()))
                 return {};
             const auto &layer = m_data[key.second];
@@ -289,7 +290,7 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         LayerIndex getMaxCalculatedLayer(coord_t radius) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
             auto layer_idx = LayerIndex(m_data.size()) - 1;
             for (; layer_idx > 0; -- layer_idx)
                 if (const auto &layer = m_data[layer_idx]; layer.find(radius) != layer.end())
@@ -319,7 +320,10 @@ private:
         void                allocate_layers(size_t num_layers);
 
         Layers              m_data;
-        mutable std::mutex  m_mutex;
+        // Shared so that the frequent cache lookups from the parallel tree support propagation
+        // do not serialize on each other; exclusive locking is only taken to insert newly
+        // calculated areas, which after precalculate() is the rare exception.
+        mutable std::shared_mutex m_mutex;
     };
 
 
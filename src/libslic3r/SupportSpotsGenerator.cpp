@@ -271,6 +271,25 @@ PrecomputedSliceConnections precompute_slices_connections(const PrintObject *po)
     return result;
 };
 
+// Boundary of the layer below each layer, to be queried for overhang distances of the
+// extrusions. The boundaries are pure per-layer geometry, thus they may be extracted
+// and indexed in parallel before the serial stability reduction runs over the layers.
+using PrecomputedLayerBoundaries = std::vector<AABBTreeLines::LinesDistancer<Linef>>;
+PrecomputedLayerBoundaries precompute_layer_boundaries(const PrintObject *po)
+{
+    PrecomputedLayerBoundaries result(po->layer_count());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, po->layer_count()), [po, &result](tbb::blocked_range<size_t> r) {
+        for (size_t lidx = r.begin(); lidx < r.end(); lidx++) {
+            const Layer *l = po->get_layer(lidx);
+            if (l->lower_layer != nullptr) {
+                result[lidx] = AABBTreeLines::LinesDistancer<Linef>{to_unscaled_linesf(l->lower_layer->lslices)};
+            }
+        }
+    });
+
+    return result;
+};
+
 float get_flow_width(const LayerRegion *region, ExtrusionRole role)
 {
     if (role == ExtrusionRole::BridgeInfill) return region->flow(FlowRole::frExternalPerimeter).width();
@@ -939,7 +958,7 @@ std::vector<EnitityToCheck> gather_entities_to_check(const Layer* layer) {
 
 LocalSupports compute_local_supports(
     const std::vector<EnitityToCheck>& entities_to_check,
-    const std::optional<Linesf>& previous_layer_boundary,
+    const AABBTreeLines::LinesDistancer<Linef>& prev_layer_boundary_distancer,
     const LD& prev_layer_ext_perim_lines,
     size_t slices_count,
     const Params& params
@@ -947,9 +966,6 @@ LocalSupports compute_local_supports(
     std::vector<tbb::concurrent_vector<ExtrusionLine>> unstable_lines_per_slice(slices_count);
     std::vector<tbb::concurrent_vector<ExtrusionLine>> ext_perim_lines_per_slice(slices_count);
 
-    AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary_distancer =
-        (previous_layer_boundary ? AABBTreeLines::LinesDistancer<Linef>{*previous_layer_boundary} : AABBTreeLines::LinesDistancer<Linef>{});
-
     if constexpr (debug_files) {
         for (const auto &e_to_check : entities_to_check) {
             for (const auto &line : check_extrusion_entity_stability(e_to_check.e, e_to_check.region, prev_layer_ext_perim_lines,
@@ -1125,6 +1141,7 @@ void reckon_global_supports(const tbb::concurrent_vector<ExtrusionLine> &externa
 
 std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject                 *po,
                                                           const PrecomputedSliceConnections &precomputed_slices_connections,
+                                                          const PrecomputedLayerBoundaries  &precomputed_layer_boundaries,
                                                           const PrintTryCancel              &cancel_func,
                                                           const Params                      &params)
 {
@@ -1144,12 +1161,8 @@ std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject
 
         slice_mappings = update_active_object_parts(layer, params, precomputed_slices_connections[layer_idx], slice_mappings, active_object_parts, partial_objects);
 
-        std::optional<Linesf> prev_layer_boundary = layer->lower_layer != nullptr ?
-                                                        std::optional{to_unscaled_linesf(layer->lower_layer->lslices)} :
-                                                        std::nullopt;
-
         LocalSupports local_supports{
-            compute_local_supports(gather_entities_to_check(layer), prev_layer_boundary, prev_layer_ext_perim_lines, layer->lslices_ex.size(), params)};
+            compute_local_supports(gather_entities_to_check(layer), precomputed_layer_boundaries[layer_idx], prev_layer_ext_perim_lines, layer->lslices_ex.size(), params)};
 
         std::vector<ExtrusionLine> current_layer_ext_perims_lines{};
         current_layer_ext_perims_lines.reserve(prev_layer_ext_perim_lines.get_lines().size());
@@ -1231,7 +1244,8 @@ void debug_export(const SupportPoints& support_points,const PartialObjects& obje
 std::tuple<SupportPoints, PartialObjects> full_search(const PrintObject *po, const PrintTryCancel& cancel_func, const Params &params)
 {
     auto precomputed_slices_connections = precompute_slices_connections(po);
-    auto results = check_stability(po, precomputed_slices_connections, cancel_func, params);
+    auto precomputed_layer_boundaries   = precompute_layer_boundaries(po);
+    auto results = check_stability(po, precomputed_slices_connections, precomputed_layer_boundaries, cancel_func, params);
 #ifdef DEBUG_FILES
     auto [supp_points, objects] = results;
     debug_export(supp_points, objects, "issues");
@@ -26,6 +26,7 @@
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/concurrent_vector.h>
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_reduce.h>
 #include <cmath>
 #include <vector>
 #include <utility>
@@ -53,6 +54,68 @@
 
 namespace Slic3r {
 
+// Minimum number of vertices from which the vertex loops below are spread over multiple threads.
+// Meshes of scanned or sculpted origin easily reach millions of vertices and the scalar loops
+// then dominate interactive manipulation of the scene.
+static constexpr const size_t parallel_vertex_loop_threshold = 65536;
+
+template<typename VertexFn>
+static std::pair<Vec3f, Vec3f> minmax_vertices(const std::vector<stl_vertex> &vertices, VertexFn fn)
+{
+    std::pair<Vec3f, Vec3f> init { fn(vertices.front()), fn(vertices.front()) };
+    auto accumulate = [&vertices, fn](const tbb::blocked_range<size_t> &range, std::pair<Vec3f, Vec3f> acc) {
+        for (size_t i = range.begin(); i < range.end(); ++ i) {
+            const Vec3f p = fn(vertices[i]);
+            acc.first  = p.cwiseMin(acc.first);
+            acc.second = p.cwiseMax(acc.second);
+        }
+        return acc;
+    };
+    if (vertices.size() < parallel_vertex_loop_threshold)
+        return accumulate(tbb::blocked_range<size_t>(0, vertices.size()), init);
+    return tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, vertices.size()), init, accumulate,
+        [](std::pair<Vec3f, Vec3f> l, const std::pair<Vec3f, Vec3f> &r) {
+            l.first  = l.first.cwiseMin(r.first);
+            l.second = l.second.cwiseMax(r.second);
+            return l;
+        });
+}
+
+BoundingBoxf3 bounding_box(const indexed_triangle_set &its)
+{
+    if (its.vertices.empty())
+        return {};
+
+    auto [bmin, bmax] = minmax_vertices(its.vertices, [](const stl_vertex &v) { return v; });
+    return {bmin.cast<double>(), bmax.cast<double>()};
+}
+
+BoundingBoxf3 bounding_box(const indexed_triangle_set &its, const Transform3f &tr)
+{
+    if (its.vertices.empty())
+        return {};
+
+    auto [bmin, bmax] = minmax_vertices(its.vertices, [&tr](const stl_vertex &v) -> Vec3f { return tr * v; });
+    return {bmin.cast<double>(), bmax.cast<double>()};
+}
+
+// Counterpart of its_transform() from admesh, spreading the vertex transform over multiple threads.
+template<typename TransformT>
+static void transform_vertices(indexed_triangle_set &its, const TransformT &t)
+{
+    auto transform_range = [&its, &t](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i) {
+            stl_vertex &v = its.vertices[i];
+            v = (t * v.cast<double>()).template cast<float>().eval();
+        }
+    };
+    if (its.vertices.size() < parallel_vertex_loop_threshold)
+        transform_range(tbb::blocked_range<size_t>(0, its.vertices.size()));
+    else
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, its.vertices.size()), transform_range);
+}
+
 static void update_bounding_box(const indexed_triangle_set &its, TriangleMeshStats &out)
 {
     BoundingBoxf3 bbox      = Slic3r::bounding_box(its);
@@ -365,7 +428,7 @@ void TriangleMesh::mirror(const Axis axis)
 
 void TriangleMesh::transform(const Transform3d& t, bool fix_left_handed)
 {
-    its_transform(its, t);
+    transform_vertices(its, t);
     double det = t.matrix().block(0, 0, 3, 3).determinant();
     if (fix_left_handed && det < 0.) {
         its_flip_triangles(its);
@@ -377,7 +440,7 @@ void TriangleMesh::transform(const Transform3d& t, bool fix_left_handed)
 
 void TriangleMesh::transform(const Matrix3d& m, bool fix_left_handed)
 {
-    its_transform(its, m);
+    transform_vertices(its, m);
     double det = m.block(0, 0, 3, 3).determinant();
     if (fix_left_handed && det < 0.) {
         its_flip_triangles(its);
@@ -476,10 +539,16 @@ BoundingBoxf3 TriangleMesh::bounding_box() const
 
 BoundingBoxf3 TriangleMesh::transformed_bounding_box(const Transform3d &trafo) const
 {
-    BoundingBoxf3 bbox;
-    for (const stl_vertex &v : this->its.vertices)
-        bbox.merge(trafo * v.cast<double>());
-    return bbox;
+    auto accumulate = [this, &trafo](const tbb::blocked_range<size_t> &range, BoundingBoxf3 bbox) {
+        for (size_t i = range.begin(); i < range.end(); ++ i)
+            bbox.merge(trafo * this->its.vertices[i].cast<double>());
+        return bbox;
+    };
+    if (its.vertices.size() < parallel_vertex_loop_threshold)
+        return accumulate(tbb::blocked_range<size_t>(0, its.vertices.size()), BoundingBoxf3());
+    return tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, its.vertices.size()), BoundingBoxf3(), accumulate,
+        [](BoundingBoxf3 l, const BoundingBoxf3 &r) { l.merge(r); return l; });
 }
 
 BoundingBoxf3 TriangleMesh::transformed_bounding_box(const Transform3d& trafod, double world_min_z) const
@@ -1763,20 +1832,39 @@ bool its_write_stl_binary(const char *file, const char *label, const std::vector
     big_endian_reverse_quads(reinterpret_cast<char*>(&nfaces), 4);
     ::fwrite(&nfaces, 4, 1, fp);
 
-    stl_facet f;
-    f.extra[0] = 0;
-    f.extra[1] = 0;
-    for (const stl_triangle_vertex_indices& face : indices) {
-        f.vertex[0] = vertices[face(0)];
-        f.vertex[1] = vertices[face(1)];
-        f.vertex[2] = vertices[face(2)];
-        f.normal = (f.vertex[1] - f.vertex[0]).cross(f.vertex[2] - f.vertex[1]).normalized();
-        big_endian_reverse_quads(reinterpret_cast<char*>(&f), 48);
-        fwrite(&f, 50, 1, fp);
+    // Pack the 50 byte facets into a buffer chunk by chunk, computing the normals of a chunk
+    // in parallel and flushing it with a single fwrite. Writing facet by facet leaves the
+    // export of huge meshes bound by millions of tiny fwrite calls.
+    static constexpr const size_t facet_size = 50;
+    static constexpr const size_t facets_per_chunk = 32768;
+    std::vector<char> buffer(facets_per_chunk * facet_size);
+    bool result = true;
+    for (size_t chunk_begin = 0; chunk_begin < indices.size(); chunk_begin += facets_per_chunk) {
+        const size_t chunk_end = std::min(chunk_begin + facets_per_chunk, indices.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(chunk_begin, chunk_end),
+            [&indices, &vertices, &buffer, chunk_begin](const tbb::blocked_range<size_t> &range) {
+            stl_facet f;
+            f.extra[0] = 0;
+            f.extra[1] = 0;
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const stl_triangle_vertex_indices &face = indices[i];
+                f.vertex[0] = vertices[face(0)];
+                f.vertex[1] = vertices[face(1)];
+                f.vertex[2] = vertices[face(2)];
+                f.normal = (f.vertex[1] - f.vertex[0]).cross(f.vertex[2] - f.vertex[1]).normalized();
+                big_endian_reverse_quads(reinterpret_cast<char*>(&f), 48);
+                ::memcpy(buffer.data() + (i - chunk_begin) * facet_size, &f, facet_size);
+            }
+        });
+        if (::fwrite(buffer.data(), facet_size, chunk_end - chunk_begin, fp) != chunk_end - chunk_begin) {
+            BOOST_LOG_TRIVIAL(error) << "its_write_stl_binary: Error writing into " << file;
+            result = false;
+            break;
+        }
     }
 
     fclose(fp);
-    return true;
+    return result;
 }
 
 
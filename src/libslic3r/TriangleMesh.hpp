@@ -392,36 +392,9 @@ bool        its_write_stl_binary(const char *file, const char *label, const std:
 inline bool its_write_stl_binary(const char *file, const char *label, const indexed_triangle_set &its) { return its_write_stl_binary(file, label, its.indices, its.vertices); }
 
 inline BoundingBoxf3 bounding_box(const TriangleMesh &m) { return m.bounding_box(); }
-inline BoundingBoxf3 bounding_box(const indexed_triangle_set& its)
-{
-    if (its.vertices.empty())
-        return {};
-
-    Vec3f bmin = its.vertices.front(), bmax = its.vertices.front();
-
-    for (const Vec3f &p : its.vertices) {
-        bmin = p.cwiseMin(bmin);
-        bmax = p.cwiseMax(bmax);
-    }
-
-    return {bmin.cast<double>(), bmax.cast<double>()};
-}
-
-inline BoundingBoxf3 bounding_box(const indexed_triangle_set& its, const Transform3f &tr)
-{
-    if (its.vertices.empty())
-        return {};
-
-    Vec3f bmin = tr * its.vertices.front(), bmax = tr * its.vertices.front();
-
-    for (const Vec3f &p : its.vertices) {
-        Vec3f pp = tr * p;
-        bmin = pp.cwiseMin(bmin);
-        bmax = pp.cwiseMax(bmax);
-    }
-
-    return {bmin.cast<double>(), bmax.cast<double>()};
-}
+// Min / max reduction over the mesh vertices, parallelized for large meshes.
+BoundingBoxf3 bounding_box(const indexed_triangle_set &its);
+BoundingBoxf3 bounding_box(const indexed_triangle_set &its, const Transform3f &tr);
 
 } // namespace Slic3r
 
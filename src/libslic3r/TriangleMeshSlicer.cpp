@@ -6,6 +6,7 @@
 #include <ankerl/unordered_dense.h>
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_invoke.h>
 #include <oneapi/tbb/scalable_allocator.h>
 #include <algorithm>
 #include <cmath>
@@ -419,6 +420,62 @@ private:
     std::array<CacheLineAlignedMutex, 64> m_mutexes;
 };
 
+// Structure-of-arrays Z spans of mesh facets, precomputed once per mesh so that facets may be
+// classified against batches of slicing planes without touching the indexed triangle set.
+struct FacetZSpans
+{
+    std::vector<float> min_z;
+    std::vector<float> max_z;
+};
+
+// Build per-facet Z spans from a structure-of-arrays copy of transformed vertex Z coordinates.
+// The inner loops process 8 facets per iteration branchless over contiguous arrays, thus compilers
+// emit packed min/max instructions (AVX2 / NEON) for them without hand written intrinsics.
+template<typename TransformVertex>
+static FacetZSpans compute_facet_z_spans(
+    const std::vector<stl_vertex>                  &mesh_vertices,
+    const TransformVertex                          &transform_vertex_fn,
+    const std::vector<stl_triangle_vertex_indices> &indices)
+{
+    std::vector<float> vertex_z(mesh_vertices.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, mesh_vertices.size(), 4096),
+        [&mesh_vertices, &transform_vertex_fn, &vertex_z](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                vertex_z[i] = transform_vertex_fn(mesh_vertices[i]).z();
+        });
+
+    FacetZSpans spans;
+    spans.min_z.resize(indices.size());
+    spans.max_z.resize(indices.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, indices.size(), 4096),
+        [&indices, &vertex_z, &spans](const tbb::blocked_range<size_t> &range) {
+            size_t       i   = range.begin();
+            const size_t end = range.end();
+            // Batch of 8 gathered Z triples, classified branchless.
+            float z0[8], z1[8], z2[8];
+            for (; i + 8 <= end; i += 8) {
+                for (size_t j = 0; j < 8; ++ j) {
+                    const stl_triangle_vertex_indices &tri = indices[i + j];
+                    z0[j] = vertex_z[tri(0)];
+                    z1[j] = vertex_z[tri(1)];
+                    z2[j] = vertex_z[tri(2)];
+                }
+                for (size_t j = 0; j < 8; ++ j)
+                    spans.min_z[i + j] = std::min(z0[j], std::min(z1[j], z2[j]));
+                for (size_t j = 0; j < 8; ++ j)
+                    spans.max_z[i + j] = std::max(z0[j], std::max(z1[j], z2[j]));
+            }
+            for (; i < end; ++ i) {
+                const stl_triangle_vertex_indices &tri = indices[i];
+                spans.min_z[i] = std::min(vertex_z[tri(0)], std::min(vertex_z[tri(1)], vertex_z[tri(2)]));
+                spans.max_z[i] = std::max(vertex_z[tri(0)], std::max(vertex_z[tri(1)], vertex_z[tri(2)]));
+            }
+        });
+    return spans;
+}
+
 template<typename TransformVertex>
 void slice_facet_at_zs(
     // Scaled or unscaled vertices. transform_vertex_fn may scale zs.
@@ -427,6 +484,9 @@ void slice_facet_at_zs(
     const stl_triangle_vertex_indices                &indices,
     const Vec3i                                      &edge_ids,
     const ColorPolygon::Color                         facet_color,
+    // Precomputed transformed Z span of this facet, see compute_facet_z_spans().
+    const float                                       min_z,
+    const float                                       max_z,
     // Scaled or unscaled zs. If vertices have their zs scaled or transform_vertex_fn scales them, then zs have to be scaled as well.
     const std::vector<float>                         &zs,
     std::vector<IntersectionLines>                   &lines,
@@ -434,10 +494,6 @@ void slice_facet_at_zs(
 {
     stl_vertex vertices[3] { transform_vertex_fn(mesh_vertices[indices(0)]), transform_vertex_fn(mesh_vertices[indices(1)]), transform_vertex_fn(mesh_vertices[indices(2)]) };
 
-    // find facet extents
-    const float min_z = fminf(vertices[0].z(), fminf(vertices[1].z(), vertices[2].z()));
-    const float max_z = fmaxf(vertices[0].z(), fmaxf(vertices[1].z(), vertices[2].z()));
-    
     // find layer extents
     auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
     auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
@@ -467,13 +523,23 @@ static inline std::vector<IntersectionLines> slice_make_lines(
 {
     std::vector<IntersectionLines> lines(zs.size(), IntersectionLines{});
     LinesMutexes                   lines_mutex;
+    // Classify all facets against the batch of slicing planes first. The spans are SoA, thus the
+    // trivial rejection of facets outside of the sliced Z range below is cheap and vectorizable.
+    const FacetZSpans              spans = compute_facet_z_spans(vertices, transform_vertex_fn, indices);
+    const float                    zs_min = zs.empty() ? 0.f : zs.front();
+    const float                    zs_max = zs.empty() ? 0.f : zs.back();
     tbb::parallel_for(
         tbb::blocked_range<int>(0, int(indices.size())),
-        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &facet_color_fn, &zs, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
+        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &facet_color_fn, &zs, &spans, zs_min, zs_max, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
             for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
                 if ((face_idx & 0x0ffff) == 0)
                     throw_on_cancel_fn();
-                slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], facet_color_fn(face_idx), zs, lines, lines_mutex);
+                const float min_z = spans.min_z[face_idx];
+                const float max_z = spans.max_z[face_idx];
+                // Ignore horizontal triangles and triangles not intersecting any of the slicing planes.
+                // Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
+                if (min_z != max_z && max_z >= zs_min && min_z <= zs_max)
+                    slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], facet_color_fn(face_idx), min_z, max_z, zs, lines, lines_mutex);
             }
         }
     );
@@ -2206,6 +2272,78 @@ std::vector<ExPolygons> slice_mesh_ex(
     return layers;
 }
 
+// FNV-1a hash over the vertex and index buffers of a mesh, used by the incremental
+// slice_mesh_ex() below to verify that a cached result still belongs to this geometry.
+// One linear pass over the buffers, negligible compared to slicing the mesh.
+static uint64_t mesh_geometry_hash(const indexed_triangle_set &mesh)
+{
+    auto fnv1a_words = [](const void *data, size_t size_bytes, uint64_t hash) {
+        auto *words = static_cast<const uint32_t*>(data);
+        for (size_t i = 0; i < size_bytes / sizeof(uint32_t); ++ i) {
+            hash ^= words[i];
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    };
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash ^= mesh.vertices.size();
+    hash *= 0x100000001b3ULL;
+    hash = fnv1a_words(mesh.vertices.data(), mesh.vertices.size() * sizeof(mesh.vertices.front()), hash);
+    hash = fnv1a_words(mesh.indices.data(), mesh.indices.size() * sizeof(mesh.indices.front()), hash);
+    return hash;
+}
+
+std::vector<ExPolygons> slice_mesh_ex(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParamsEx        &params,
+    MeshSliceCache                   &cache,
+    std::function<void()>             throw_on_cancel)
+{
+    const uint64_t mesh_hash = params.slicing_mode_normal_below_layer == 0 ? mesh_geometry_hash(mesh) : 0;
+    // With slicing_mode_normal_below_layer the slicing mode depends on the layer index, not just on its Z,
+    // thus a cached layer may not be transplanted to a different index. Don't cache in that mode.
+    const bool cache_usable = params.slicing_mode_normal_below_layer == 0 &&
+        cache.m_valid &&
+        cache.m_mesh_hash == mesh_hash &&
+        cache.m_params == params;
+
+    std::vector<ExPolygons> layers;
+    if (! cache_usable) {
+        layers = slice_mesh_ex(mesh, zs, params, throw_on_cancel);
+    } else {
+        layers.assign(zs.size(), ExPolygons{});
+        // Zs of the layers not found in the cache, to be sliced in a single batch.
+        std::vector<float>  dirty_zs;
+        std::vector<size_t> dirty_ids;
+        for (size_t i = 0; i < zs.size(); ++ i) {
+            auto it = std::lower_bound(cache.m_zs.begin(), cache.m_zs.end(), zs[i]);
+            if (it != cache.m_zs.end() && *it == zs[i])
+                layers[i] = cache.m_layers[it - cache.m_zs.begin()];
+            else {
+                dirty_zs.emplace_back(zs[i]);
+                dirty_ids.emplace_back(i);
+            }
+        }
+        if (! dirty_zs.empty()) {
+            std::vector<ExPolygons> dirty_layers = slice_mesh_ex(mesh, dirty_zs, params, throw_on_cancel);
+            for (size_t i = 0; i < dirty_ids.size(); ++ i)
+                layers[dirty_ids[i]] = std::move(dirty_layers[i]);
+        }
+    }
+
+    if (params.slicing_mode_normal_below_layer == 0) {
+        cache.m_valid     = true;
+        cache.m_mesh_hash = mesh_hash;
+        cache.m_params    = params;
+        cache.m_zs        = zs;
+        cache.m_layers    = layers;
+    } else
+        cache.clear();
+
+    return layers;
+}
+
 // Slice a triangle set with a set of Z slabs (thick layers).
 // The effect is similar to producing the usual top / bottom layers from a sliced mesh by 
 // subtracting layer[i] from layer[i - 1] for the top surfaces resp.
@@ -2271,27 +2409,32 @@ void slice_mesh_slabs(
     const auto mirrored_sign = int64_t(trafo.matrix().block(0, 0, 3, 3).determinant() < 0 ? -1 : 1);
 
     std::vector<FaceOrientation> face_orientation(mesh.indices.size(), FaceOrientation::Up);
-    for (const stl_triangle_vertex_indices &tri : mesh.indices) {
-        const Vec3f   fa = vertices_transformed[tri(0)];
-        const Vec3f   fb = vertices_transformed[tri(1)];
-        const Vec3f   fc = vertices_transformed[tri(2)];
-        assert(fa != fb && fa != fc && fb != fc);
-        const Point   a = to_2d(fa).cast<coord_t>();
-        const Point   b = to_2d(fb).cast<coord_t>();
-        const Point   c = to_2d(fc).cast<coord_t>();
-        const int64_t d = cross2((b - a).cast<int64_t>(), (c - b).cast<int64_t>()) * mirrored_sign;
-        FaceOrientation fo = FaceOrientation::Vertical;
-        if (d > 0)
-            fo = FaceOrientation::Up;
-        else if (d < 0)
-            fo = FaceOrientation::Down;
-        else {
-            // Is the triangle vertical or degenerate?
-            assert(d == 0);
-            fo = fa == fb || fa == fc || fb == fc ? FaceOrientation::Degenerate : FaceOrientation::Vertical;
-        }
-        face_orientation[&tri - mesh.indices.data()] = fo;
-    }
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, mesh.indices.size(), 4096),
+        [&mesh, &vertices_transformed, mirrored_sign, &face_orientation](const tbb::blocked_range<size_t> &range) {
+            for (size_t face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
+                const stl_triangle_vertex_indices &tri = mesh.indices[face_idx];
+                const Vec3f   fa = vertices_transformed[tri(0)];
+                const Vec3f   fb = vertices_transformed[tri(1)];
+                const Vec3f   fc = vertices_transformed[tri(2)];
+                assert(fa != fb && fa != fc && fb != fc);
+                const Point   a = to_2d(fa).cast<coord_t>();
+                const Point   b = to_2d(fb).cast<coord_t>();
+                const Point   c = to_2d(fc).cast<coord_t>();
+                const int64_t d = cross2((b - a).cast<int64_t>(), (c - b).cast<int64_t>()) * mirrored_sign;
+                FaceOrientation fo = FaceOrientation::Vertical;
+                if (d > 0)
+                    fo = FaceOrientation::Up;
+                else if (d < 0)
+                    fo = FaceOrientation::Down;
+                else {
+                    // Is the triangle vertical or degenerate?
+                    assert(d == 0);
+                    fo = fa == fb || fa == fc || fb == fc ? FaceOrientation::Degenerate : FaceOrientation::Vertical;
+                }
+                face_orientation[face_idx] = fo;
+            }
+        });
 
     std::vector<Vec3i> face_neighbors = its_face_neighbors_par(mesh);
     int                num_edges;
@@ -2302,10 +2445,18 @@ void slice_mesh_slabs(
 
     throw_on_cancel();
 
-    if (out_top)
-        *out_top = make_slab_loops<true>(lines.first, num_edges, throw_on_cancel);
-    if (out_bottom)
-        *out_bottom = make_slab_loops<false>(lines.second, num_edges, throw_on_cancel);
+    // The top and bottom slabs are chained from independent line sets, process them concurrently.
+    // Each of them parallelizes internally over layers, parallel_invoke just lets the two loop
+    // sets share the worker pool instead of draining it twice in sequence.
+    tbb::parallel_invoke(
+        [out_top, &lines, num_edges, &throw_on_cancel]() {
+            if (out_top)
+                *out_top = make_slab_loops<true>(lines.first, num_edges, throw_on_cancel);
+        },
+        [out_bottom, &lines, num_edges, &throw_on_cancel]() {
+            if (out_bottom)
+                *out_bottom = make_slab_loops<false>(lines.second, num_edges, throw_on_cancel);
+        });
 }
 
 // Remove duplicates of slice_vertices, optionally triangulate the cut.
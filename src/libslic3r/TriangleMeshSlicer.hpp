@@ -50,6 +50,12 @@ struct MeshSlicingParams
     SlicingMode   mode_below { SlicingMode::Regular };
     // Transforming faces during the slicing.
     Transform3d   trafo { Transform3d::Identity() };
+
+    bool operator==(const MeshSlicingParams &rhs) const {
+        return this->mode == rhs.mode && this->slicing_mode_normal_below_layer == rhs.slicing_mode_normal_below_layer &&
+               this->mode_below == rhs.mode_below && this->trafo.matrix() == rhs.trafo.matrix();
+    }
+    bool operator!=(const MeshSlicingParams &rhs) const { return ! (*this == rhs); }
 };
 
 struct MeshSlicingParamsEx : public MeshSlicingParams
@@ -61,6 +67,38 @@ struct MeshSlicingParamsEx : public MeshSlicingParams
     // Resolution for contour simplification, unscaled.
     // 0 = don't simplify.
     double        resolution { 0 };
+
+    bool operator==(const MeshSlicingParamsEx &rhs) const {
+        return static_cast<const MeshSlicingParams&>(*this) == static_cast<const MeshSlicingParams&>(rhs) &&
+               this->closing_radius == rhs.closing_radius && this->extra_offset == rhs.extra_offset && this->resolution == rhs.resolution;
+    }
+    bool operator!=(const MeshSlicingParamsEx &rhs) const { return ! (*this == rhs); }
+};
+
+// Cache of the last slice_mesh_ex() result over a single mesh, allowing incremental re-slicing:
+// when the caller re-slices the same mesh with the same parameters but a modified Z vector
+// (edited layer height ranges, inserted / removed layers), only the layers with new Z values
+// are recomputed, the remaining layers are taken over from the cache.
+// The cached result is verified against a content hash of the mesh geometry and against the
+// slicing parameters, thus the caller does not need to invalidate the cache on mesh edits.
+class MeshSliceCache
+{
+public:
+    void clear() { m_valid = false; m_zs.clear(); m_layers.clear(); }
+
+private:
+    bool                    m_valid { false };
+    // Content hash of the vertex and index buffers of the sliced mesh. Hashing is cheap
+    // compared to slicing and catches reuse over modified geometry.
+    uint64_t                m_mesh_hash { 0 };
+    MeshSlicingParamsEx     m_params;
+    // Sorted Z values of the cached layers.
+    std::vector<float>      m_zs;
+    std::vector<ExPolygons> m_layers;
+
+    friend std::vector<ExPolygons> slice_mesh_ex(
+        const indexed_triangle_set &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params,
+        MeshSliceCache &cache, std::function<void()> throw_on_cancel);
 };
 
 // All the following slicing functions shall produce consistent results with the same mesh, same transformation matrix and slicing parameters.
@@ -103,6 +141,15 @@ std::vector<ExPolygons>         slice_mesh_ex(
     const MeshSlicingParamsEx        &params,
     std::function<void()>             throw_on_cancel = []{});
 
+// Incremental variant: layers whose Z value is found in the cache are reused, only layers
+// with new Z values are sliced. The cache is refreshed with the produced result.
+std::vector<ExPolygons>         slice_mesh_ex(
+    const indexed_triangle_set       &mesh,
+    const std::vector<float>         &zs,
+    const MeshSlicingParamsEx        &params,
+    MeshSliceCache                   &cache,
+    std::function<void()>             throw_on_cancel = []{});
+
 inline std::vector<ExPolygons>  slice_mesh_ex(
     const indexed_triangle_set       &mesh,
     const std::vector<float>         &zs,
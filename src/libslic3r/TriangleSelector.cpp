@@ -257,14 +257,14 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
     std::vector<int> facets_to_check = m_cursor->get_facets_to_select(facet_start, m_vertices, m_triangles, m_orig_size_vertices, m_orig_size_indices);
     facets_to_check.reserve(16);
     // Keep track of facets of the original mesh we already processed.
-    std::vector<bool> visited(m_orig_size_indices, false);
+    start_visit_epoch();
     // Breadth-first search around the hit point. facets_to_check may grow significantly large.
     // Head of the bread-first facets_to_check FIFO.
     int facet_idx = 0;
     while (facet_idx < int(facets_to_check.size())) {
         int          facet        = facets_to_check[facet_idx];
         const Vec3f &facet_normal = m_face_normals[m_triangles[facet].source_triangle];
-        if (!visited[facet] && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
+        if (!was_visited(facet) && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
             if (select_triangle(facet, new_state, triangle_splitting)) {
                 // add neighboring facets to list to be processed later
                 for (int neighbor_idx : m_neighbors[facet])
@@ -272,11 +272,24 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
                         facets_to_check.push_back(neighbor_idx);
             }
         }
-        visited[facet] = true;
+        mark_visited(facet);
         ++facet_idx;
     }
 }
 
+// Start a new traversal epoch over m_triangles. The scratch buffer is kept
+// allocated between brush strokes, it only needs clearing when the epoch
+// counter wraps around.
+void TriangleSelector::start_visit_epoch()
+{
+    if (m_visited_epochs.size() < m_triangles.size())
+        m_visited_epochs.resize(m_triangles.size(), 0);
+    if (++ m_visited_epoch == 0) {
+        std::fill(m_visited_epochs.begin(), m_visited_epochs.end(), 0);
+        m_visited_epoch = 1;
+    }
+}
+
 bool TriangleSelector::is_facet_clipped(int facet_idx, const ClippingPlane &clp) const
 {
     for (int vert_idx : m_triangles[facet_idx].verts_idxs)
@@ -312,7 +325,7 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
 
     this->seed_fill_unselect_all_triangles();
 
-    std::vector<bool> visited(m_triangles.size(), false);
+    start_visit_epoch();
     std::queue<int>   facet_queue;
     facet_queue.push(facet_start);
 
@@ -329,12 +342,12 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
         facet_queue.pop();
 
         const Vec3f &facet_normal = m_face_normals[m_triangles[current_facet].source_triangle];
-        if (!visited[current_facet] && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
+        if (!was_visited(current_facet) && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
             if (m_triangles[current_facet].is_split()) {
                 for (int split_triangle_idx = 0; split_triangle_idx <= m_triangles[current_facet].number_of_split_sides(); ++split_triangle_idx) {
                     assert(split_triangle_idx < int(m_triangles[current_facet].children.size()));
                     assert(m_triangles[current_facet].children[split_triangle_idx] < int(m_triangles.size()));
-                    if (int child = m_triangles[current_facet].children[split_triangle_idx]; !visited[child]) {
+                    if (int child = m_triangles[current_facet].children[split_triangle_idx]; !was_visited(child)) {
                         // Child triangle shares normal with its parent. Select it.
                         facet_queue.push(child);
                     }
@@ -346,7 +359,7 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
                 // Propagate over the original triangles.
                 for (int neighbor_idx : m_neighbors[current_facet]) {
                     assert(neighbor_idx >= -1);
-                    if (neighbor_idx >= 0 && !visited[neighbor_idx] && !is_facet_clipped(neighbor_idx, clp)) {
+                    if (neighbor_idx >= 0 && !was_visited(neighbor_idx) && !is_facet_clipped(neighbor_idx, clp)) {
                         // Check if neighbour_facet_idx is satisfies angle in seed_fill_angle and append it to facet_queue if it do.
                         const Vec3f &n1 = m_face_normals[m_triangles[neighbor_idx].source_triangle];
                         const Vec3f &n2 = m_face_normals[m_triangles[current_facet].source_triangle];
@@ -360,27 +373,27 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
             }
         }
 
-        visited[current_facet] = true;
+        mark_visited(current_facet);
     }
 
     seed_fill_fill_gaps(gap_fill_candidate_facets, seed_fill_gap_area);
 }
 
 void TriangleSelector::seed_fill_fill_gaps(const std::vector<int> &gap_fill_candidate_facets, const float seed_fill_gap_area) {
-    std::vector<bool> visited(m_triangles.size(), false);
+    start_visit_epoch();
 
     for (const int starting_facet_idx: gap_fill_candidate_facets) {
         const Triangle &starting_facet = m_triangles[starting_facet_idx];
 
         // If starting_facet_idx was visited from any facet, then we can skip it.
-        if (visited[starting_facet_idx])
+        if (was_visited(starting_facet_idx))
             continue;
 
         // In the way how gap_fill_candidate_facets is filled, neither of the following two conditions should ever be met.
         // But both of those conditions are here to allow more general usage of this method.
         if (starting_facet.is_selected_by_seed_fill() || starting_facet.is_split()) {
             // Already selected by seed fill or split facet, so no additional actions are required.
-            visited[starting_facet_idx] = true;
+            mark_visited(starting_facet_idx);
             continue;
         } else if (!is_any_neighbor_selected_by_seed_fill(starting_facet)) {
             // No neighbor triangles are selected by seed fill, so we will skip them for now.
@@ -400,7 +413,7 @@ void TriangleSelector::seed_fill_fill_gaps(const std::vector<int> &gap_fill_cand
             const Triangle &current_facet     = m_triangles[current_facet_idx];
             facet_queue.pop();
 
-            if (visited[current_facet_idx])
+            if (was_visited(current_facet_idx))
                 continue;
 
             if (this->is_original_triangle(current_facet_idx))
@@ -412,7 +425,7 @@ void TriangleSelector::seed_fill_fill_gaps(const std::vector<int> &gap_fill_cand
                 // Otherwise, we incorrectly select facets that are in a gap that is bigger
                 // than seed_fill_gap_area.
                 for (const int gap_facet_idx : gap_facets)
-                    visited[gap_facet_idx] = false;
+                    unmark_visited(gap_facet_idx);
 
                 gap_facets.clear();
                 break;
@@ -422,7 +435,7 @@ void TriangleSelector::seed_fill_fill_gaps(const std::vector<int> &gap_fill_cand
                 for (int split_triangle_idx = 0; split_triangle_idx <= current_facet.number_of_split_sides(); ++split_triangle_idx) {
                     assert(split_triangle_idx < int(current_facet.children.size()));
                     assert(current_facet.children[split_triangle_idx] < int(m_triangles.size()));
-                    if (int child = current_facet.children[split_triangle_idx]; !visited[child])
+                    if (int child = current_facet.children[split_triangle_idx]; !was_visited(child))
                         facet_queue.push(child);
                 }
             } else if (total_gap_area < seed_fill_gap_area) {
@@ -433,12 +446,12 @@ void TriangleSelector::seed_fill_fill_gaps(const std::vector<int> &gap_fill_cand
                 // Propagate over the original triangles.
                 for (int neighbor_idx: m_neighbors[current_facet_idx]) {
                     assert(neighbor_idx >= -1);
-                    if (neighbor_idx >= 0 && !visited[neighbor_idx] && !m_triangles[neighbor_idx].is_selected_by_seed_fill())
+                    if (neighbor_idx >= 0 && !was_visited(neighbor_idx) && !m_triangles[neighbor_idx].is_selected_by_seed_fill())
                         facet_queue.push(neighbor_idx);
                 }
             }
 
-            visited[current_facet_idx] = true;
+            mark_visited(current_facet_idx);
         }
 
         for (int to_seed_idx : gap_facets)
@@ -599,7 +612,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f &hit, int facet_
     const float facet_angle_limit = std::cos(Geometry::deg2rad(bucket_fill_angle)) - EPSILON;
 
     auto [neighbors, neighbors_propagated] = this->precompute_all_neighbors();
-    std::vector<bool>  visited(m_triangles.size(), false);
+    start_visit_epoch();
     std::queue<int>    facet_queue;
 
     // Facets that need to be checked for gap filling.
@@ -611,12 +624,12 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f &hit, int facet_
         facet_queue.pop();
         assert(!m_triangles[current_facet].is_split());
 
-        if (!visited[current_facet]) {
+        if (!was_visited(current_facet)) {
             m_triangles[current_facet].select_by_seed_fill();
 
             std::vector<int> touching_triangles = this->get_all_touching_triangles(current_facet, neighbors[current_facet], neighbors_propagated[current_facet]);
             for (const int tr_idx: touching_triangles) {
-                if (tr_idx < 0 || visited[tr_idx] || m_triangles[tr_idx].get_state() != start_facet_state || is_facet_clipped(tr_idx, clp))
+                if (tr_idx < 0 || was_visited(tr_idx) || m_triangles[tr_idx].get_state() != start_facet_state || is_facet_clipped(tr_idx, clp))
                     continue;
 
                 // Check if neighbour_facet_idx is satisfies angle in seed_fill_angle and append it to facet_queue if it do.
@@ -631,7 +644,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f &hit, int facet_
             }
         }
 
-        visited[current_facet] = true;
+        mark_visited(current_facet);
     }
 
     bucket_fill_fill_gaps(gap_fill_candidate_facets, bucket_fill_gap_area, start_facet_state, neighbors, neighbors_propagated);
@@ -640,20 +653,20 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f &hit, int facet_
 void TriangleSelector::bucket_fill_fill_gaps(const std::vector<int> &gap_fill_candidate_facets, const float bucket_fill_gap_area,
                                              const TriangleStateType start_facet_state, const std::vector<Vec3i> &neighbors,
                                              const std::vector<Vec3i> &neighbors_propagated) {
-    std::vector<bool> visited(m_triangles.size(), false);
+    start_visit_epoch();
 
     for (const int starting_facet_idx: gap_fill_candidate_facets) {
         const Triangle &starting_facet = m_triangles[starting_facet_idx];
 
         // If starting_facet_idx was visited from any facet, then we can skip it.
-        if (visited[starting_facet_idx])
+        if (was_visited(starting_facet_idx))
             continue;
 
         // In the way how gap_fill_candidate_facets is filled, neither of the following two conditions should ever be met.
         // But both of those conditions are here to allow more general usage of this method.
         if (starting_facet.is_selected_by_seed_fill() || starting_facet.is_split()) {
             // Already selected by seed fill or split facet, so no additional actions are required.
-            visited[starting_facet_idx] = true;
+            mark_visited(starting_facet_idx);
             continue;
         }
 
@@ -671,7 +684,7 @@ void TriangleSelector::bucket_fill_fill_gaps(const std::vector<int> &gap_fill_ca
             const Triangle &current_facet     = m_triangles[current_facet_idx];
             facet_queue.pop();
 
-            if (visited[current_facet_idx])
+            if (was_visited(current_facet_idx))
                 continue;
 
             total_gap_area += get_triangle_area(current_facet);
@@ -682,7 +695,7 @@ void TriangleSelector::bucket_fill_fill_gaps(const std::vector<int> &gap_fill_ca
                 // Otherwise, we incorrectly select facets that are in a gap that is bigger
                 // than bucket_fill_gap_area.
                 for (const int gap_facet_idx : gap_facets)
-                    visited[gap_facet_idx] = false;
+                    unmark_visited(gap_facet_idx);
 
                 gap_facets.clear();
                 break;
@@ -692,13 +705,13 @@ void TriangleSelector::bucket_fill_fill_gaps(const std::vector<int> &gap_fill_ca
 
             std::vector<int> touching_triangles = this->get_all_touching_triangles(current_facet_idx, neighbors[current_facet_idx], neighbors_propagated[current_facet_idx]);
             for (const int tr_idx: touching_triangles) {
-                if (tr_idx < 0 || visited[tr_idx] || m_triangles[tr_idx].get_state() != start_facet_state || m_triangles[tr_idx].is_selected_by_seed_fill())
+                if (tr_idx < 0 || was_visited(tr_idx) || m_triangles[tr_idx].get_state() != start_facet_state || m_triangles[tr_idx].is_selected_by_seed_fill())
                     continue;
 
                 facet_queue.push(tr_idx);
             }
 
-            visited[current_facet_idx] = true;
+            mark_visited(current_facet_idx);
         }
 
         for (int to_seed_idx : gap_facets)
@@ -1389,7 +1402,7 @@ void TriangleSelector::garbage_collect()
 }
 
 TriangleSelector::TriangleSelector(const TriangleMesh& mesh)
-    : m_mesh{mesh}, m_neighbors(its_face_neighbors(mesh.its)), m_face_normals(its_face_normals(mesh.its))
+    : m_mesh{mesh}, m_neighbors(its_face_neighbors_par(mesh.its)), m_face_normals(its_face_normals(mesh.its))
 {
     reset();
 }
@@ -572,6 +572,19 @@ private:
 
     int m_free_triangles_head { -1 };
     int m_free_vertices_head { -1 };
+
+    // Scratch buffer for the breadth-first traversals in select_patch() and the
+    // seed / bucket fill methods. A facet counts as visited when its slot holds
+    // the current epoch, thus starting a new traversal just bumps the epoch
+    // instead of allocating and clearing an O(triangle count) buffer for every
+    // brush stroke event.
+    std::vector<unsigned int> m_visited_epochs;
+    unsigned int              m_visited_epoch = 0;
+
+    void start_visit_epoch();
+    bool was_visited(int facet_idx) const { return m_visited_epochs[facet_idx] == m_visited_epoch; }
+    void mark_visited(int facet_idx) { m_visited_epochs[facet_idx] = m_visited_epoch; }
+    void unmark_visited(int facet_idx) { m_visited_epochs[facet_idx] = 0; }
 };
 
 
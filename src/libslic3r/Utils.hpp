@@ -32,6 +32,9 @@ extern std::string format_memsize(size_t bytes, unsigned int decimals = 1);
 // Latter is used to get the memory info from SysInfoDialog.
 extern std::string log_memory_info(bool ignore_loglevel = false);
 extern void enforce_thread_count(std::size_t count);
+// Returns the current resident set size (physical memory used by the process) in bytes,
+// zero if not available on the platform.
+extern size_t current_resident_memory();
 // Returns the size of physical memory (RAM) in bytes.
 extern size_t total_physical_memory();
 
@@ -60,6 +60,12 @@ public:
     /// This method throws exactly like finish_entry() does.
     void add_entry(const std::string& name, const void* data, size_t bytes);
 
+    /// Same as above, but overriding the archive wide compression level for
+    /// this single entry. Useful for data that is compressed already (e.g.
+    /// PNG images), which would only burn CPU time in deflate for no gain.
+    void add_entry(const std::string& name, const void* data, size_t bytes,
+                   e_compression level);
+
     // Writing data to the archive works like with standard streams. The target
     // within the zip file is the entry created with the add_entry method.
 
@@ -1208,6 +1208,28 @@ std::string log_memory_info(bool ignore_loglevel)
     return out;
 }
 
+// Returns the current resident set size (physical memory used by the process) in bytes,
+// zero if not available on the platform.
+size_t current_resident_memory()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return (size_t)pmc.WorkingSetSize;
+#elif defined(__APPLE__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &infoCount) == KERN_SUCCESS)
+        return (size_t)info.resident_size;
+#elif defined(__linux__)
+    size_t tSize = 0, resident = 0;
+    boost::nowide::ifstream buffer("/proc/self/statm");
+    if (buffer && (buffer >> tSize >> resident))
+        return resident * (size_t)sysconf(_SC_PAGE_SIZE);
+#endif
+    return 0;
+}
+
 // Returns the size of physical memory (RAM) in bytes.
 // http://nadeausoftware.com/articles/2012/09/c_c_tip_how_get_physical_memory_size_system
 size_t total_physical_memory()
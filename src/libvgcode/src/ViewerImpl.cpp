@@ -16,6 +16,7 @@
 #include <string>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numeric>
 
 namespace libvgcode {
@@ -879,6 +880,9 @@ void ViewerImpl::reset()
 #else
     m_enabled_segments_count = 0;
     m_enabled_options_count = 0;
+    m_colors_buf_capacity = 0;
+    m_enabled_segments_buf_capacity = 0;
+    m_enabled_options_buf_capacity = 0;
 
     m_settings_used_for_ranges = std::nullopt;
 
@@ -902,9 +906,13 @@ void ViewerImpl::reset()
 // to position and heights_widths_angles vectors
 using Vec4 = std::array<float, 4>;
 
+// Extract the data of the vertices in the interval [first_vertex_id, last_vertex_id).
+// The interval allows processing the vertices in chunks, so that the staging vectors
+// do not need to hold a full copy of the gpu data at once.
 static void extract_pos_and_or_hwa(const std::vector<PathVertex>& vertices, float travels_radius, float wipes_radius, BitSet<>& valid_lines_bitset,
-    std::vector<Vec4>* positions = nullptr, std::vector<Vec4>* heights_widths_angles = nullptr, bool update_bitset = false) {
-  static constexpr const Vec3 ZERO = { 0.0f, 0.0f, 0.0f };
+    std::vector<Vec4>* positions = nullptr, std::vector<Vec4>* heights_widths_angles = nullptr, bool update_bitset = false,
+    size_t first_vertex_id = 0, size_t last_vertex_id = std::numeric_limits<size_t>::max()) {
+    static constexpr const Vec3 ZERO = { 0.0f, 0.0f, 0.0f };
     if (positions == nullptr && heights_widths_angles == nullptr)
         return;
     if (vertices.empty())
@@ -912,11 +920,13 @@ static void extract_pos_and_or_hwa(const std::vector<PathVertex>& vertices, floa
     if (travels_radius <= 0.0f || wipes_radius <= 0.0f)
         return;
 
+    last_vertex_id = std::min(last_vertex_id, vertices.size());
+    const size_t count = last_vertex_id - first_vertex_id;
     if (positions != nullptr)
-        positions->reserve(vertices.size());
+        positions->reserve(count);
     if (heights_widths_angles != nullptr)
-        heights_widths_angles->reserve(vertices.size());
-    for (size_t i = 0; i < vertices.size(); ++i) {
+        heights_widths_angles->reserve(count);
+    for (size_t i = first_vertex_id; i < last_vertex_id; ++i) {
         const PathVertex& v = vertices[i];
         const EMoveType move_type = v.type;
         const bool prev_line_valid = i > 0 && valid_lines_bitset[i - 1];
@@ -1040,6 +1050,7 @@ void ViewerImpl::load(GCodeInputData&& gcode_data)
     if (m_settings.time_mode != ETimeMode::Normal && m_total_time[static_cast<size_t>(m_settings.time_mode)] == 0.0f)
         m_settings.time_mode = ETimeMode::Normal;
 
+#ifdef ENABLE_OPENGL_ES
     // buffers to send to gpu
     // the last component is a dummy float to comply with GL_RGBA32F format
     std::vector<Vec4> positions;
@@ -1049,33 +1060,51 @@ void ViewerImpl::load(GCodeInputData&& gcode_data)
     extract_pos_and_or_hwa(m_vertices, m_travels_radius, m_wipes_radius, m_valid_lines_bitset, &positions, &heights_widths_angles, true);
 
     if (!positions.empty()) {
-#ifdef ENABLE_OPENGL_ES
         m_texture_data.init(positions.size());
         // create and fill position textures
         m_texture_data.set_positions(positions);
         // create and fill height, width and angle textures
         m_texture_data.set_heights_widths_angles(heights_widths_angles);
 #else
-        m_positions_tex_size = positions.size() * sizeof(Vec3);
-        m_height_width_angle_tex_size = heights_widths_angles.size() * sizeof(Vec3);
+    if (!m_vertices.empty() && m_travels_radius > 0.0f && m_wipes_radius > 0.0f) {
+        m_positions_tex_size = m_vertices.size() * sizeof(Vec3);
+        m_height_width_angle_tex_size = m_vertices.size() * sizeof(Vec3);
 
         int old_bound_texture = 0;
         glsafe(glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &old_bound_texture));
 
-        // create and fill positions buffer
+        // create positions buffer
         glsafe(glGenBuffers(1, &m_positions_buf_id));
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_positions_buf_id));
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, positions.size() * sizeof(Vec4), positions.data(), GL_STATIC_DRAW));
+        glsafe(glBufferData(GL_TEXTURE_BUFFER, m_vertices.size() * sizeof(Vec4), nullptr, GL_STATIC_DRAW));
         glsafe(glGenTextures(1, &m_positions_tex_id));
         glsafe(glBindTexture(GL_TEXTURE_BUFFER, m_positions_tex_id));
 
-        // create and fill height, width and angles buffer
+        // create height, width and angles buffer
         glsafe(glGenBuffers(1, &m_heights_widths_angles_buf_id));
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_heights_widths_angles_buf_id));
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, heights_widths_angles.size() * sizeof(Vec4), heights_widths_angles.data(), GL_DYNAMIC_DRAW));
+        glsafe(glBufferData(GL_TEXTURE_BUFFER, m_vertices.size() * sizeof(Vec4), nullptr, GL_DYNAMIC_DRAW));
         glsafe(glGenTextures(1, &m_heights_widths_angles_tex_id));
         glsafe(glBindTexture(GL_TEXTURE_BUFFER, m_heights_widths_angles_tex_id));
 
+        // Extract and fill both buffers chunk by chunk, so that the staging vectors
+        // do not duplicate the whole gpu data in host memory. On prints with hundreds
+        // of millions of moves full staging copies used to double the memory peak of load().
+        // the last component is a dummy float to comply with GL_RGBA32F format
+        std::vector<Vec4> positions;
+        std::vector<Vec4> heights_widths_angles;
+        static constexpr const size_t EXTRACT_CHUNK_SIZE = 1024 * 1024;
+        for (size_t first_id = 0; first_id < m_vertices.size(); first_id += EXTRACT_CHUNK_SIZE) {
+            const size_t last_id = std::min(first_id + EXTRACT_CHUNK_SIZE, m_vertices.size());
+            positions.clear();
+            heights_widths_angles.clear();
+            extract_pos_and_or_hwa(m_vertices, m_travels_radius, m_wipes_radius, m_valid_lines_bitset, &positions, &heights_widths_angles, true, first_id, last_id);
+            glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_positions_buf_id));
+            glsafe(glBufferSubData(GL_TEXTURE_BUFFER, first_id * sizeof(Vec4), positions.size() * sizeof(Vec4), positions.data()));
+            glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_heights_widths_angles_buf_id));
+            glsafe(glBufferSubData(GL_TEXTURE_BUFFER, first_id * sizeof(Vec4), heights_widths_angles.size() * sizeof(Vec4), heights_widths_angles.data()));
+        }
+
         // create (but do not fill) colors buffer (data is set in update_colors())
         glsafe(glGenBuffers(1, &m_colors_buf_id));
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_colors_buf_id));
@@ -1172,20 +1201,27 @@ void ViewerImpl::update_enabled_entities()
     m_enabled_options_tex_size = enabled_options.size() * sizeof(uint32_t);
 
     // update gpu buffer for enabled segments
+    // the buffer is updated in place whenever the new data fit into the storage
+    // allocated by a previous update, so that scrubbing the layers slider does
+    // not reallocate the buffer on every step
     assert(m_enabled_segments_buf_id > 0);
     glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_enabled_segments_buf_id));
-    if (!enabled_segments.empty())
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, enabled_segments.size() * sizeof(uint32_t), enabled_segments.data(), GL_STATIC_DRAW));
-    else
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, 0, nullptr, GL_STATIC_DRAW));
+    if (m_enabled_segments_tex_size > m_enabled_segments_buf_capacity) {
+        m_enabled_segments_buf_capacity = m_enabled_segments_tex_size;
+        glsafe(glBufferData(GL_TEXTURE_BUFFER, m_enabled_segments_tex_size, enabled_segments.data(), GL_DYNAMIC_DRAW));
+    }
+    else if (!enabled_segments.empty())
+        glsafe(glBufferSubData(GL_TEXTURE_BUFFER, 0, m_enabled_segments_tex_size, enabled_segments.data()));
 
     // update gpu buffer for enabled options
     assert(m_enabled_options_buf_id > 0);
     glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_enabled_options_buf_id));
-    if (!enabled_options.empty())
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, enabled_options.size() * sizeof(uint32_t), enabled_options.data(), GL_STATIC_DRAW));
-    else
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, 0, nullptr, GL_STATIC_DRAW));
+    if (m_enabled_options_tex_size > m_enabled_options_buf_capacity) {
+        m_enabled_options_buf_capacity = m_enabled_options_tex_size;
+        glsafe(glBufferData(GL_TEXTURE_BUFFER, m_enabled_options_tex_size, enabled_options.data(), GL_DYNAMIC_DRAW));
+    }
+    else if (!enabled_options.empty())
+        glsafe(glBufferSubData(GL_TEXTURE_BUFFER, 0, m_enabled_options_tex_size, enabled_options.data()));
 
     glsafe(glBindBuffer(GL_TEXTURE_BUFFER, 0));
 #endif // ENABLE_OPENGL_ES
@@ -1228,9 +1264,14 @@ void ViewerImpl::update_colors_texture()
     #else
         m_colors_tex_size = colors.size() * sizeof(float);
 
-        // update gpu buffer for colors
+        // update gpu buffer for colors, reusing the already allocated storage when possible
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, m_colors_buf_id));
-        glsafe(glBufferData(GL_TEXTURE_BUFFER, colors.size() * sizeof(float), colors.data(), GL_STATIC_DRAW));
+        if (m_colors_tex_size > m_colors_buf_capacity) {
+            m_colors_buf_capacity = m_colors_tex_size;
+            glsafe(glBufferData(GL_TEXTURE_BUFFER, m_colors_tex_size, colors.data(), GL_DYNAMIC_DRAW));
+        }
+        else if (!colors.empty())
+            glsafe(glBufferSubData(GL_TEXTURE_BUFFER, 0, m_colors_tex_size, colors.data()));
         glsafe(glBindBuffer(GL_TEXTURE_BUFFER, 0));
     #endif // ENABLE_OPENGL_ES
 }
@@ -448,6 +448,14 @@ private:
     size_t m_colors_tex_size{ 0 };
     size_t m_enabled_segments_tex_size{ 0 };
     size_t m_enabled_options_tex_size{ 0 };
+    //
+    // Capacities of the gpu buffers which are updated whenever the view range
+    // or the visibility settings change, in bytes. The buffers are grown on
+    // demand and the already allocated storage is reused when the new data fit.
+    //
+    size_t m_colors_buf_capacity{ 0 };
+    size_t m_enabled_segments_buf_capacity{ 0 };
+    size_t m_enabled_options_buf_capacity{ 0 };
 #endif // ENABLE_OPENGL_ES
 
     void update_view_full_range();
@@ -2,6 +2,7 @@
 
 #include "occtwrapper_export.h"
 
+#include <algorithm>
 #include <cassert>
 
 #ifdef _WIN32
@@ -22,6 +23,7 @@
 #include "TopExp_Explorer.hxx"
 #include "BRep_Tool.hxx"
 #include "admesh/stl.h"
+#include "libslic3r/Execution/ExecutionTBB.hpp"
 #include "libslic3r/Point.hpp"
 
 const double STEP_TRANS_CHORD_ERROR = 0.005;
@@ -128,12 +130,19 @@ try {
     std::string obj_name((last_slash == nullptr) ? path : last_slash + 1);
     res->object_name = obj_name;
 
-    for (const NamedSolid &namedSolid : namedSolids) {
+    res->volumes.resize(namedSolids.size());
+
+    // Tessellate the solids in parallel. Each solid owns a copy of its geometry
+    // (see the copying BRepBuilderAPI_Transform in getNamedSolids()), thus
+    // meshing one solid does not touch the data of another one.
+    execution::for_each(ex_tbb, size_t(0), namedSolids.size(),
+        [&namedSolids, res](size_t solid_idx) {
+        const NamedSolid &namedSolid = namedSolids[solid_idx];
+        OCCTVolume       &volume     = res->volumes[solid_idx];
         BRepMesh_IncrementalMesh mesh(namedSolid.solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
-        res->volumes.emplace_back();
 
         std::vector<Vec3f>      vertices;
-        std::vector<stl_facet> &facets = res->volumes.back().facets;
+        std::vector<stl_facet> &facets = volume.facets;
         for (TopExp_Explorer anExpSF(namedSolid.solid, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
             const int aNodeOffset = int(vertices.size());
             const TopoDS_Shape& aFace = anExpSF.Current();
@@ -173,11 +182,17 @@ try {
             }
         }
 
-        res->volumes.back().volume_name = namedSolid.name;
+        volume.volume_name = namedSolid.name;
 
         if (vertices.empty())
-            res->volumes.pop_back();        
-    }
+            facets.clear();
+    },
+    execution::max_concurrency(ex_tbb));
+
+    // Drop the solids for which no triangulation was generated.
+    res->volumes.erase(std::remove_if(res->volumes.begin(), res->volumes.end(),
+                                      [](const OCCTVolume &volume) { return volume.facets.empty(); }),
+                       res->volumes.end());
 
     shapeTool.reset(nullptr);
     application->Close(document);
@@ -5,6 +5,7 @@
 #ifndef ARRANGEITEM_HPP
 #define ARRANGEITEM_HPP
 
+#include <boost/functional/hash.hpp>
 #include <boost/variant.hpp>
 #include <libslic3r/ClipperUtils.hpp>
 #include <assert.h>
@@ -15,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <cassert>
@@ -310,6 +312,78 @@ template<> struct WritableDataStoreTraits_<ArrangeItem>
     }
 };
 
+// Cache of pairwise convex-convex NFPs. The shape of the NFP of two convex polygons is
+// invariant to their translations (nfp_convex_convex_legacy() builds it from edge vectors
+// and only anchors it by a final translation), so the result can be stored normalized to
+// its reference vertex and keyed by the translation-invariant outlines of both operands.
+// Plates usually carry many copies of the same part, which makes the hit rate very high.
+class NFPPairCache
+{
+    struct Key
+    {
+        Points fixed;
+        Points movable;
+
+        bool operator==(const Key &other) const
+        {
+            return fixed == other.fixed && movable == other.movable;
+        }
+    };
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key &key) const
+        {
+            size_t seed = 0;
+            for (const Points *pts : {&key.fixed, &key.movable})
+                for (const Point &pt : *pts) {
+                    boost::hash_combine(seed, pt.x());
+                    boost::hash_combine(seed, pt.y());
+                }
+
+            return seed;
+        }
+    };
+
+    // Translate the polygon points so that the first point is in the origin,
+    // making the key invariant to the current placement of the operands.
+    static Points normalized_points(const Polygon &poly)
+    {
+        Points pts = poly.points;
+        if (!pts.empty()) {
+            Point head = pts.front();
+            for (Point &pt : pts)
+                pt -= head;
+        }
+
+        return pts;
+    }
+
+    static constexpr size_t Capacity = 10000;
+
+    std::unordered_map<Key, Polygon, KeyHasher> m_cache;
+
+public:
+    // Returns the NFP of the operands translated so that its reference vertex
+    // lies in the origin.
+    const Polygon &nfp(const Polygon &fixed, const Polygon &movable)
+    {
+        Key key{normalized_points(fixed), normalized_points(movable)};
+        auto it = m_cache.find(key);
+        if (it == m_cache.end()) {
+            if (m_cache.size() >= Capacity)
+                m_cache.clear();
+
+            Polygon subnfp = nfp_convex_convex_legacy(fixed, movable);
+            Vec2crd ref    = Slic3r::reference_vertex(subnfp);
+            subnfp.translate(-ref.x(), -ref.y());
+            it = m_cache.emplace(std::move(key), std::move(subnfp)).first;
+        }
+
+        return it->second;
+    }
+};
+
 template<class FixedIt, class StopCond = DefaultStopCondition>
 static Polygons calculate_nfp_unnormalized(const ArrangeItem    &item,
                                            const Range<FixedIt> &fixed_items,
@@ -327,7 +401,9 @@ static Polygons calculate_nfp_unnormalized(const ArrangeItem    &item,
     auto nfps = reserve_polygons(cap * item_outlines.size());
 
     Vec2crd ref_whole = item.envelope().reference_vertex();
-    Polygon subnfp;
+
+    // Pairwise NFPs of identical part shapes repeat many times on a typical plate, cache them.
+    static thread_local NFPPairCache nfp_cache;
 
     for (const ArrangeItem &fixed : fixed_items) {
         // fixed_polys should already be a set of strictly convex polygons,
@@ -339,18 +415,17 @@ static Polygons calculate_nfp_unnormalized(const ArrangeItem    &item,
             for (size_t mi = 0; mi < item_outlines.size(); ++mi) {
                 const Polygon &movable = item_outlines[mi];
                 const Vec2crd &mref = item.envelope().reference_vertex(mi);
-                subnfp = nfp_convex_convex_legacy(fixed_poly, movable);
+                // The cached NFP has its reference vertex translated into the origin.
+                Polygon subnfp = nfp_cache.nfp(fixed_poly, movable);
 
                 Vec2crd min_movable = item.envelope().min_vertex(mi);
 
                 Vec2crd dtouch = max_fixed - min_movable;
                 Vec2crd top_other = mref + dtouch;
-                Vec2crd max_nfp = Slic3r::reference_vertex(subnfp);
-                auto dnfp = top_other - max_nfp;
 
-                auto d = ref_whole - mref + dnfp;
+                auto d = ref_whole - mref + top_other;
                 subnfp.translate(d);
-                nfps.emplace_back(subnfp);
+                nfps.emplace_back(std::move(subnfp));
             }
 
             if (stop_cond())
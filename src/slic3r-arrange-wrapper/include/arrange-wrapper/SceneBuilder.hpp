@@ -129,6 +129,10 @@ public:
         : m_seldata{std::move(seld)}, m_wp{wp}
     {}
 
+    explicit FixedSelection(std::vector<std::vector<bool>> seld, bool wp = false)
+        : m_seldata{std::move(seld)}, m_wp{wp}
+    {}
+
     explicit FixedSelection(const Model &m);
 
     explicit FixedSelection(const SelectionMask &other);
@@ -426,12 +426,13 @@ const Snapshot&	SnapshotDB::take_snapshot(const AppConfig &app_config, Snapshot:
                 cfg.models_variants_installed.erase(it ++);
             else
                 ++ it;
-        // Read the active config bundle, parse the config version.
-        PresetBundle bundle;
-        bundle.load_configbundle((data_dir / "vendor" / (cfg.name + ".ini")).string(), PresetBundle::LoadConfigBundleAttribute::LoadVendorOnly, ForwardCompatibilitySubstitutionRule::EnableSilent);
-        for (const auto &vp : bundle.vendors)
-            if (vp.second.id == cfg.name)
-                cfg.version.config_version = vp.second.config_version;
+        // Read the config version from the header of the active config bundle. Only the vendor section
+        // is parsed, building a full PresetBundle for each vendor would be needlessly expensive here.
+        try {
+            cfg.version.config_version = VendorProfile::from_ini(data_dir / "vendor" / (cfg.name + ".ini"), false).config_version;
+        } catch (const std::exception &err) {
+            BOOST_LOG_TRIVIAL(error) << "Failed reading the config version of the vendor bundle " << cfg.name << ": " << err.what();
+        }
         // Fill-in the min/max slic3r version from the config index, if possible.
         try {
             // Load the config index for the vendor.
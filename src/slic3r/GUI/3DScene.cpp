@@ -793,8 +793,29 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
     }
     auto time_now = std::chrono::system_clock::now();
 
-
-
+    // Uniforms shared by all volumes rendered with the current shader are uploaded
+    // just once per render() call. Uniform values persist in the program object,
+    // thus the per volume loop below only updates the per volume ones.
+    curr_shader->start_using();
+    curr_shader->set_uniform("z_range", m_z_range);
+    curr_shader->set_uniform("clipping_plane", m_clipping_plane);
+    curr_shader->set_uniform("use_color_clip_plane", m_use_color_clip_plane);
+    curr_shader->set_uniform("color_clip_plane", m_color_clip_plane);
+    curr_shader->set_uniform("uniform_color_clip_plane_1", m_color_clip_plane_colors[0]);
+    curr_shader->set_uniform("uniform_color_clip_plane_2", m_color_clip_plane_colors[1]);
+    curr_shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
+    curr_shader->set_uniform("print_volume.xy_data", m_print_volume.data);
+    curr_shader->set_uniform("print_volume.z_data", m_print_volume.zs);
+    curr_shader->set_uniform("slope.normal_z", m_slope.normal_z);
+    curr_shader->set_uniform("projection_matrix", projection_matrix);
+#if ENABLE_ENVIRONMENT_MAP
+    unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
+    bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get_bool("use_environment_map");
+    curr_shader->set_uniform("use_environment_tex", use_environment_texture);
+    if (use_environment_texture)
+        glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
+#endif // ENABLE_ENVIRONMENT_MAP
+    curr_shader->stop_using();
 
     for (GLVolumeWithIdAndZ& volume : to_render) {
         if (!volume.first->is_active)
@@ -812,15 +833,13 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
         volume.first->set_render_color(true);
 
         // render sinking contours of non-hovered volumes
-        if (sink_shader != nullptr) {
-            sink_shader->start_using();
-            if (m_show_sinking_contours) {
-                if (volume.first->is_sinking() && !volume.first->is_below_printbed() &&
-                    volume.first->hover == GLVolume::HS_None && !volume.first->force_sinking_contours) {
-                    volume.first->render_sinking_contours();
-                }
+        if (sink_shader != nullptr && m_show_sinking_contours) {
+            if (volume.first->is_sinking() && !volume.first->is_below_printbed() &&
+                volume.first->hover == GLVolume::HS_None && !volume.first->force_sinking_contours) {
+                sink_shader->start_using();
+                volume.first->render_sinking_contours();
+                sink_shader->stop_using();
             }
-            sink_shader->stop_using();
         }
 
         if (render_as_mmu_painted && shader != mmu_painted_shader)
@@ -875,46 +894,27 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
         }
         else {
             shader->start_using();
-            shader->set_uniform("z_range", m_z_range);
-            shader->set_uniform("clipping_plane", m_clipping_plane);
-            shader->set_uniform("use_color_clip_plane", m_use_color_clip_plane);
-            shader->set_uniform("color_clip_plane", m_color_clip_plane);
-            shader->set_uniform("uniform_color_clip_plane_1", m_color_clip_plane_colors[0]);
-            shader->set_uniform("uniform_color_clip_plane_2", m_color_clip_plane_colors[1]);
-            shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
-            shader->set_uniform("print_volume.xy_data", m_print_volume.data);
-            shader->set_uniform("print_volume.z_data", m_print_volume.zs);
             shader->set_uniform("volume_world_matrix", world_matrix);
             shader->set_uniform("slope.actived", m_slope.active && !volume.first->is_modifier && !volume.first->is_wipe_tower());
             shader->set_uniform("slope.volume_world_normal_matrix", static_cast<Matrix3f>(world_matrix_inv_transp.cast<float>()));
-            shader->set_uniform("slope.normal_z", m_slope.normal_z);
-
-#if ENABLE_ENVIRONMENT_MAP
-            unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
-            bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get_bool("use_environment_map");
-            shader->set_uniform("use_environment_tex", use_environment_texture);
-            if (use_environment_texture)
-                glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
-#endif // ENABLE_ENVIRONMENT_MAP
             glcheck();
 
             volume.first->model.set_color(volume.first->render_color);
             shader->set_uniform("view_model_matrix", view_matrix * world_matrix);
-            shader->set_uniform("projection_matrix", projection_matrix);
             shader->set_uniform("view_normal_matrix", view_normal_matrix);
             volume.first->render();
 
-#if ENABLE_ENVIRONMENT_MAP
-            if (use_environment_texture)
-                glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
-#endif // ENABLE_ENVIRONMENT_MAP
-
             glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
             glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
             shader->stop_using();
         }
     }
 
+#if ENABLE_ENVIRONMENT_MAP
+    if (use_environment_texture)
+        glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
+#endif // ENABLE_ENVIRONMENT_MAP
+
 
     // Purge the painted triangles cache from everything that was not used for some time.
     // Only do this occasionally (once a second).
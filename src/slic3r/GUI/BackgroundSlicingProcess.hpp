@@ -137,6 +137,12 @@ public:
 	// After calling the apply() function, set_task() may be called to limit the task to be processed by process().
 	// This is useful for calculating SLA supports for a single object only.
 	void 		set_task(const PrintBase::TaskParams &params);
+	// Ask the FFF pipeline to process the layers inside the given Z window (the layers currently
+	// visible in the 3D view) first, so their preview becomes available before the rest of the
+	// plate is finished. A scheduling hint only, it never changes the produced result and may be
+	// updated while the background process is running. No-op for SLA prints.
+	void 		set_priority_z_window(double min_z, double max_z) { if (m_fff_print) m_fff_print->set_priority_z_window(min_z, max_z); }
+	void 		clear_priority_z_window() { if (m_fff_print) m_fff_print->clear_priority_z_window(); }
 	// After calling apply, the empty() call will report whether there is anything to slice.
 	bool 		empty() const;
 	// Validate the print. Returns an empty string if valid, returns an error message if invalid.
@@ -1224,6 +1224,18 @@ void GCodeViewer::load_as_gcode(const GCodeProcessorResult& gcode_result, const
     m_sequential_collision_detected = gcode_result.sequential_collision_detected;
 }
 
+std::vector<std::pair<uint32_t, uint32_t>> GCodeViewer::get_gcode_id_runs() const
+{
+    std::vector<std::pair<uint32_t, uint32_t>> runs;
+    const size_t vertices_count = m_viewer.get_vertices_count();
+    for (size_t i = 0; i < vertices_count; ++i) {
+        const uint32_t gcode_id = m_viewer.get_vertex_at(i).gcode_id;
+        if (runs.empty() || runs.back().second != gcode_id)
+            runs.emplace_back(static_cast<uint32_t>(i), gcode_id);
+    }
+    return runs;
+}
+
 void GCodeViewer::load_as_preview(libvgcode::GCodeInputData&& data)
 {
     m_loaded_as_preview = true;
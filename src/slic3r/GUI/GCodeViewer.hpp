@@ -1,9 +1,9 @@
-///|/ Copyright (c) Prusa Research 2020 - 2023 Enrico Turri @enricoturri1966, Vojtěch Bubník @bubnikv, Lukáš Matěna @lukasmatena, Filip Sykala @Jony01, Oleksandra Iushchenko @YuSanka
-///|/ Copyright (c) BambuStudio 2023 manch1n @manch1n
-///|/ Copyright (c) SuperSlicer 2023 Remi Durand @supermerill
-///|/
-///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
-///|/
+///|/ Copyright (c) Prusa Research 2020 - 2023 Enrico Turri @enricoturri1966, Vojtěch Bubník @bubnikv, Lukáš Matěna @lukasmatena, Filip Sykala @Jony01, Oleksandra Iushchenko @YuSanka
+///|/ Copyright (c) BambuStudio 2023 manch1n @manch1n
+///|/ Copyright (c) SuperSlicer 2023 Remi Durand @supermerill
+///|/
+///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
+///|/
 #ifndef slic3r_GCodeViewer_hpp_
 #define slic3r_GCodeViewer_hpp_
 
@@ -324,7 +324,11 @@ public:
         std::transform(zs.begin(), zs.end(), std::back_inserter(ret), [](float z) { return static_cast<double>(z); });
         return ret;
     }
-    std::vector<float> get_layers_times() const { return m_viewer.get_layers_estimated_times(); }
+    std::vector<float> get_layers_times() const { return m_viewer.get_layers_estimated_times(); }
+    // Run-length index of consecutive path vertices sharing the same gcode_id (processing G2 / G3
+    // lines emits multiple vertices per line). Each entry holds the index of the first vertex of
+    // a run and the gcode_id of that run.
+    std::vector<std::pair<uint32_t, uint32_t>> get_gcode_id_runs() const;
 
     const SequentialView& get_sequential_view() const { return m_sequential_view; }
     void update_sequential_view_current(unsigned int first, unsigned int last);
@@ -370,8 +374,8 @@ public:
     void load_shells(const Print& print);
 
 #if VGCODE_ENABLE_COG_AND_TOOL_MARKERS
-    float get_cog_marker_scale_factor() const { return m_viewer.get_cog_marker_scale_factor(); }
-    void set_cog_marker_scale_factor(float factor) { return m_viewer.set_cog_marker_scale_factor(factor); }
+    float get_cog_marker_scale_factor() const { return m_viewer.get_cog_marker_scale_factor(); }
+    void set_cog_marker_scale_factor(float factor) { return m_viewer.set_cog_marker_scale_factor(factor); }
 #endif // VGCODE_ENABLE_COG_AND_TOOL_MARKERS
 
 private:
@@ -695,7 +695,10 @@ void GLCanvas3D::LayersEditing::reset_layer_height_profile(GLCanvas3D& canvas)
 void GLCanvas3D::LayersEditing::adaptive_layer_height_profile(GLCanvas3D& canvas, float quality_factor)
 {
     this->update_slicing_parameters();
-    m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, *m_model_object, quality_factor);
+    m_slicing_adaptive.set_slicing_parameters(*m_slicing_parameters);
+    // Reuses the per-facet slope data if the object has not changed since the last slider move.
+    m_slicing_adaptive.prepare(*m_model_object);
+    m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, m_slicing_adaptive, quality_factor);
     const_cast<ModelObject*>(m_model_object)->layer_height_profile.set(m_layer_height_profile);
     m_layers_texture.valid = false;
     canvas.post_event(SimpleEvent(EVT_GLCANVAS_SCHEDULE_BACKGROUND_PROCESS));
@@ -2923,6 +2926,7 @@ void GLCanvas3D::load_gcode_preview(const GCodeProcessorResult& gcode_result, co
     m_gcode_viewer.set_view_type(m_gcode_viewer.get_view_type());
     m_gcode_viewer.load_as_gcode(gcode_result, *this->fff_print(), str_tool_colors, str_color_print_colors);
     m_gcode_layers_times_cache = m_gcode_viewer.get_layers_times();
+    m_gcode_id_runs_cache = m_gcode_viewer.get_gcode_id_runs();
     m_gcode_viewer.set_force_shells_visible(false);
     if (wxGetApp().is_editor()) {
         _set_warning_notification_if_needed(EWarning::ToolpathOutside);
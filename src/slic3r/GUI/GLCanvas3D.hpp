@@ -28,6 +28,7 @@
 #include "ArrangeSettingsDialogImgui.hpp"
 
 #include "libslic3r/Slicing.hpp"
+#include "libslic3r/SlicingAdaptive.hpp"
 
 #include <float.h>
 
@@ -219,6 +220,8 @@ class GLCanvas3D
         SlicingParameters           *m_slicing_parameters{ nullptr };
         std::vector<double>         m_layer_height_profile;
         bool                        m_layer_height_profile_modified{ false };
+        // Caches the per-facet slope data of the selected object between the adaptive quality slider moves.
+        SlicingAdaptive             m_slicing_adaptive;
         // Shrinkage compensation to apply when we need to use object_max_z with Z compensation.
         Vec3d                       m_shrinkage_compensation{ Vec3d::Ones() };
 
@@ -610,6 +613,9 @@ private:
 
     // used to show layers times on the layers slider when pre-gcode view is active
     std::vector<float> m_gcode_layers_times_cache;
+    // run-length index of path vertices by gcode_id, used to rebuild the moves slider
+    // without rescanning the vertex buffer on each interaction
+    std::vector<std::pair<uint32_t, uint32_t>> m_gcode_id_runs_cache;
 
 public:
 
@@ -823,6 +829,8 @@ public:
     std::vector<float> get_gcode_layers_times() const { return m_gcode_viewer.get_layers_times(); }
     const std::vector<float>& get_gcode_layers_times_cache() const { return m_gcode_layers_times_cache; }
     void reset_gcode_layers_times_cache() { m_gcode_layers_times_cache.clear(); }
+    const std::vector<std::pair<uint32_t, uint32_t>>& get_gcode_id_runs_cache() const { return m_gcode_id_runs_cache; }
+    void reset_gcode_id_runs_cache() { m_gcode_id_runs_cache.clear(); }
     void set_volumes_z_range(const std::array<double, 2>& range) { m_volumes.set_range(range[0] - 1e-6, range[1] + 1e-6); }
     void set_toolpaths_z_range(const std::array<unsigned int, 2>& range);
     size_t get_gcode_extruders_count() { return m_gcode_viewer.get_extruders_count(); }
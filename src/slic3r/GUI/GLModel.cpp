@@ -26,6 +26,8 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <tbb/parallel_reduce.h>
+
 #if ENABLE_SMOOTH_NORMALS
 #include <igl/per_face_normals.h>
 #include <igl/per_corner_normals.h>
@@ -548,26 +550,33 @@ void GLModel::init_from(const indexed_triangle_set& its)
 
     Geometry& data = m_render_data.geometry;
     data.format = { Geometry::EPrimitiveType::Triangles, Geometry::EVertexLayout::P3N3 };
-    data.reserve_vertices(3 * its.indices.size());
-    data.reserve_indices(3 * its.indices.size());
-
-    // vertices + indices
-    unsigned int vertices_counter = 0;
-    for (uint32_t i = 0; i < its.indices.size(); ++i) {
-        const stl_triangle_vertex_indices face = its.indices[i];
-        const stl_vertex                  vertex[3] = { its.vertices[face[0]], its.vertices[face[1]], its.vertices[face[2]] };
-        const stl_vertex                  n = face_normal_normalized(vertex);
-        for (size_t j = 0; j < 3; ++j) {
-            data.add_vertex(vertex[j], n);
-        }
-        vertices_counter += 3;
-        data.add_triangle(vertices_counter - 3, vertices_counter - 2, vertices_counter - 1);
-    }
-
-    // update bounding box
-    for (size_t i = 0; i < vertices_count(); ++i) {
-        m_bounding_box.merge(data.extract_position_3(i).cast<double>());
-    }
+    // The expanded geometry is laid out regularly (three vertices of 6 floats
+    // per triangle, sequential indices), thus the triangles can be converted
+    // in parallel, each one writing into its own slot of the preallocated buffers.
+    const size_t vertex_stride_floats = Geometry::vertex_stride_floats(data.format);
+    data.vertices.resize(3 * vertex_stride_floats * its.indices.size());
+    data.indices.resize(3 * its.indices.size());
+
+    // vertices + indices + bounding box
+    m_bounding_box = tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, its.indices.size(), 1 << 14), BoundingBoxf3(),
+        [&its, &data, vertex_stride_floats](const tbb::blocked_range<size_t>& range, BoundingBoxf3 bbox) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const stl_triangle_vertex_indices face = its.indices[i];
+                const stl_vertex                  vertex[3] = { its.vertices[face[0]], its.vertices[face[1]], its.vertices[face[2]] };
+                const stl_vertex                  n = face_normal_normalized(vertex);
+                float *out = data.vertices.data() + 3 * vertex_stride_floats * i;
+                for (size_t j = 0; j < 3; ++j) {
+                    ::memcpy(out, vertex[j].data(), 3 * sizeof(float));
+                    ::memcpy(out + 3, n.data(), 3 * sizeof(float));
+                    out += vertex_stride_floats;
+                    data.indices[3 * i + j] = (unsigned int)(3 * i + j);
+                    bbox.merge(vertex[j].cast<double>());
+                }
+            }
+            return bbox;
+        },
+        [](BoundingBoxf3 lhs, const BoundingBoxf3& rhs) { lhs.merge(rhs); return lhs; });
 }
 
 void GLModel::init_from(const Polygon& polygon, float z)
@@ -364,6 +364,8 @@ void Preview::unbind_event_handlers()
 void Preview::hide_layers_slider()
 {
     m_layers_slider->Hide();
+    // No layer range is visible anymore, stop prioritizing the last one.
+    m_process->clear_priority_z_window();
 }
 
 void Preview::on_size(wxSizeEvent& evt)
@@ -658,6 +660,10 @@ void Preview::update_layers_slider(const std::vector<double>& layers_z, bool kee
 
     m_layers_slider->Thaw();
 
+    // Keep the priority Z window of the background process in sync with the slider span,
+    // also when the thumbs snapped back to the full range without a thumb move event.
+    m_process->set_priority_z_window(m_layers_slider->GetLowerValue(), m_layers_slider->GetHigherValue());
+
     // check if ticks_info_from_model contains ColorChange g-code
     bool color_change_already_exists = false;
     for (const CustomGCode::Item& gcode: ticks_info_from_model.gcodes)
@@ -850,44 +856,41 @@ void Preview::update_moves_slider(std::optional<int> visible_range_min, std::opt
         return;
 
     const libvgcode::Interval& range = m_canvas->get_gcode_view_enabled_range();
-    uint32_t last_gcode_id = m_canvas->get_gcode_vertex_at(range[0]).gcode_id;
     std::optional<uint32_t> gcode_id_min = visible_range_min.has_value() ?
         std::optional<uint32_t>{ m_canvas->get_gcode_vertex_at(*visible_range_min).gcode_id } : std::nullopt;
     std::optional<uint32_t> gcode_id_max = visible_range_max.has_value() ?
         std::optional<uint32_t>{ m_canvas->get_gcode_vertex_at(*visible_range_max).gcode_id } : std::nullopt;
 
-    const size_t range_size = range[1] - range[0] + 1;
+    // Iterate the precalculated run-length index of vertices by gcode_id instead of rescanning
+    // the vertex buffer. Consecutive moves with the same gcode id (resulting from processing
+    // G2 and G3 lines) form a single run and produce a single slider position.
+    const std::vector<std::pair<uint32_t, uint32_t>>& runs = m_canvas->get_gcode_id_runs_cache();
+    if (runs.empty())
+        return;
+    // Locate the run containing the first vertex of the enabled range.
+    auto it_run = std::upper_bound(runs.begin(), runs.end(), static_cast<uint32_t>(range[0]),
+        [](uint32_t lhs, const std::pair<uint32_t, uint32_t>& rhs) { return lhs < rhs.first; });
+    assert(it_run != runs.begin());
+    --it_run;
+
     std::vector<unsigned int> values;
-    values.reserve(range_size);
+    values.reserve(runs.end() - it_run);
     std::vector<unsigned int> alternate_values;
-    alternate_values.reserve(range_size);
+    alternate_values.reserve(runs.end() - it_run);
 
     std::optional<uint32_t> visible_range_min_id;
     std::optional<uint32_t> visible_range_max_id;
-    uint32_t counter = 0;
-
-    for (size_t i = range[0]; i <= range[1]; ++i) {
-        const uint32_t gcode_id = m_canvas->get_gcode_vertex_at(i).gcode_id;
-        bool skip = false;
-        if (i > range[0]) {
-            // skip consecutive moves with same gcode id (resulting from processing G2 and G3 lines)
-            if (last_gcode_id == gcode_id) {
-                values.back() = i + 1;
-                skip = true;
-            }
-            else
-                last_gcode_id = gcode_id;
-        }
 
-        if (!skip) {
-            values.emplace_back(i + 1);
-            alternate_values.emplace_back(gcode_id);
-            if (gcode_id_min.has_value() && alternate_values.back() == *gcode_id_min)
-                visible_range_min_id = counter;
-            else if (gcode_id_max.has_value() && alternate_values.back() == *gcode_id_max)
-                visible_range_max_id = counter;
-            ++counter;
-        }
+    for (; it_run != runs.end() && it_run->first <= range[1]; ++it_run) {
+        const auto it_next = std::next(it_run);
+        const uint32_t run_last = it_next == runs.end() ?
+            static_cast<uint32_t>(range[1]) : std::min(it_next->first - 1, static_cast<uint32_t>(range[1]));
+        values.emplace_back(run_last + 1);
+        alternate_values.emplace_back(it_run->second);
+        if (gcode_id_min.has_value() && it_run->second == *gcode_id_min)
+            visible_range_min_id = static_cast<uint32_t>(values.size()) - 1;
+        else if (gcode_id_max.has_value() && it_run->second == *gcode_id_max)
+            visible_range_max_id = static_cast<uint32_t>(values.size()) - 1;
     }
 
     const int span_min_id = visible_range_min_id.has_value() ? *visible_range_min_id : 0;
@@ -944,6 +947,7 @@ void Preview::load_print_as_fff(bool keep_z_range)
     if (wxGetApp().is_editor() && !has_layers) {
         m_canvas->reset_gcode_toolpaths();
         m_canvas->reset_gcode_layers_times_cache();
+        m_canvas->reset_gcode_id_runs_cache();
         m_canvas->load_gcode_shells();
         hide_layers_slider();
         m_moves_slider->Hide();
@@ -1063,6 +1067,9 @@ void Preview::on_layers_slider_scroll_changed()
         if (tech == ptFFF) {
             m_canvas->set_volumes_z_range({ m_layers_slider->GetLowerValue(), m_layers_slider->GetHigherValue() });
             m_canvas->set_toolpaths_z_range({ static_cast<unsigned int>(m_layers_slider->GetLowerPos()), static_cast<unsigned int>(m_layers_slider->GetHigherPos()) });
+            // Let the next background run process the layers the user restricted the view to first,
+            // so an edit & re-slice shows them updated before the rest of the plate is done.
+            m_process->set_priority_z_window(m_layers_slider->GetLowerValue(), m_layers_slider->GetHigherValue());
             m_canvas->set_as_dirty();
         }
         else if (tech == ptSLA) {
@@ -6,6 +6,8 @@
 
 #include <cassert>
 
+#include <tbb/parallel_for.h>
+
 #include "slic3r/GUI/GLCanvas3D.hpp"
 #include "libslic3r/SLAPrint.hpp"
 #include "slic3r/GUI/GUI_App.hpp"
@@ -252,6 +254,7 @@ void Raycaster::on_update()
         mvs = mo->volumes;
 
     std::vector<const TriangleMesh*> meshes;
+    std::vector<std::shared_ptr<const TriangleMesh>> mesh_ptrs;
     bool force_raycaster_regeneration = false;
     if (wxGetApp().preset_bundle->printers.get_selected_preset().printer_technology() == ptSLA) {
         // For sla printers we use the mesh generated by the backend
@@ -262,27 +265,40 @@ void Raycaster::on_update()
         else
             preview_mesh_ptr.reset();
 
-        m_sla_mesh_cache = (preview_mesh_ptr != nullptr) ? TriangleMesh{ *preview_mesh_ptr } : TriangleMesh();
-
-        if (!m_sla_mesh_cache.empty()) {
-            m_sla_mesh_cache.transform(po->trafo().inverse());
-            meshes.emplace_back(&m_sla_mesh_cache);
+        // Only regenerate the cached mesh and the raycaster when the backend handed out
+        // a different mesh. Switching between gizmos does not change the backend mesh.
+        if (preview_mesh_ptr != m_old_sla_mesh) {
+            m_sla_mesh_cache = (preview_mesh_ptr != nullptr) ? TriangleMesh{ *preview_mesh_ptr } : TriangleMesh();
+            if (!m_sla_mesh_cache.empty())
+                m_sla_mesh_cache.transform(po->trafo().inverse());
+            m_old_sla_mesh = preview_mesh_ptr;
             force_raycaster_regeneration = true;
         }
+
+        if (!m_sla_mesh_cache.empty())
+            meshes.emplace_back(&m_sla_mesh_cache);
     }
 
     if (meshes.empty()) {
         const std::vector<ModelVolume*>& mvs = mo->volumes;
         for (const ModelVolume* mv : mvs) {
-            if (mv->is_model_part())
+            if (mv->is_model_part()) {
                 meshes.push_back(&mv->mesh());
+                mesh_ptrs.push_back(mv->mesh_ptr());
+            }
         }
     }
 
     if (force_raycaster_regeneration || meshes != m_old_meshes) {
         m_raycasters.clear();
-        for (const TriangleMesh* mesh : meshes)
-            m_raycasters.emplace_back(new MeshRaycaster(std::make_shared<const TriangleMesh>(*mesh)));
+        m_raycasters.resize(meshes.size());
+        // Build the AABB trees of all the volumes in parallel. The mesh is shared
+        // with the ModelVolume when possible to avoid a deep copy of each mesh.
+        tbb::parallel_for(size_t(0), meshes.size(), [this, &meshes, &mesh_ptrs](size_t i) {
+            std::shared_ptr<const TriangleMesh> mesh = i < mesh_ptrs.size() && mesh_ptrs[i] != nullptr ?
+                mesh_ptrs[i] : std::make_shared<const TriangleMesh>(*meshes[i]);
+            m_raycasters[i] = std::make_unique<MeshRaycaster>(std::move(mesh));
+        });
         m_old_meshes = meshes;
     }
 }
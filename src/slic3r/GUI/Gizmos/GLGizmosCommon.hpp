@@ -230,6 +230,9 @@ private:
     std::vector<const TriangleMesh*> m_old_meshes;
     // Used to store the sla mesh coming from the backend
     TriangleMesh m_sla_mesh_cache;
+    // Which backend mesh m_sla_mesh_cache was generated from, so the cache and
+    // the raycaster are not rebuilt when the backend hands out the same mesh again.
+    std::shared_ptr<const indexed_triangle_set> m_old_sla_mesh;
 };
 
 
@@ -241,6 +241,24 @@ arr2::SceneBuilder build_scene(Plater &plater, ArrangeSelectionMode mode)
         }
         builder.set_bed_constraints(std::move(constraints));
         builder.set_considered_instances(std::move(instances_on_bed));
+    } else if (mode == ArrangeSelectionMode::NewItemsOnly) {
+        // Incremental arrange: only instances without a bed assignment are selected for
+        // packing, everything already placed is passed along unselected and thus treated
+        // as fixed geometry by the arrange task.
+        std::vector<std::vector<bool>> selmask;
+        std::set<ObjectID> considered_instances;
+        selmask.reserve(plater.model().objects.size());
+        for (const ModelObject *object : plater.model().objects) {
+            std::vector<bool> &object_mask{selmask.emplace_back(object->instances.size(), false)};
+            for (std::size_t instance_index{0}; instance_index < object->instances.size(); ++instance_index) {
+                const ModelInstance *instance{object->instances[instance_index]};
+                object_mask[instance_index] = beds_map.find(instance->id()) == beds_map.end();
+                considered_instances.insert(instance->id());
+            }
+        }
+
+        builder.set_selection(std::make_unique<arr2::FixedSelection>(std::move(selmask)));
+        builder.set_considered_instances(std::move(considered_instances));
     }
 
     builder.set_arrange_settings(plater.canvas3D()->get_arrange_settings_view());
@@ -27,7 +27,10 @@ namespace GUI {
 
 class Plater;
 
-enum class ArrangeSelectionMode { SelectionOnly, Full, CurrentBedFull, CurrentBedSelectionOnly };
+// NewItemsOnly is the incremental mode: instances already assigned to a bed keep their
+// placement and only act as fixed obstacles, a position is searched just for instances
+// that do not sit on any bed yet (freshly added or dragged off their bed).
+enum class ArrangeSelectionMode { SelectionOnly, Full, CurrentBedFull, CurrentBedSelectionOnly, NewItemsOnly };
 
 arr2::SceneBuilder build_scene(
     Plater &plater, ArrangeSelectionMode mode = ArrangeSelectionMode::Full);
@@ -1662,6 +1662,7 @@ std::vector<size_t> Plater::priv::load_model_objects(const ModelObjectPtrs& mode
     bool scaled_down = false;
     std::vector<size_t> obj_idxs;
     unsigned int obj_count = model.objects.size();
+    const bool plate_was_occupied = obj_count > 0;
 
 #ifdef AUTOPLACEMENT_ON_LOAD
     ModelInstancePtrs new_instances;
@@ -1738,6 +1739,17 @@ std::vector<size_t> Plater::priv::load_model_objects(const ModelObjectPtrs& mode
             _L("Object too large?"));
     }
 
+    // Objects inserted into an occupied plate land at the bed center, on top of whatever is
+    // already there. Pack just them around the existing placements: the instances added above
+    // are not in the instance-to-bed map yet (that happens in update() below), so the
+    // NewItemsOnly mode selects exactly them and treats everything placed as fixed geometry.
+    // apply_cut_object_to_model() passes call_selection_changed = false and arranges on its own.
+    if (call_selection_changed && plate_was_occupied && !s_multiple_beds.get_loading_project_flag()) {
+        UIThreadWorker w;
+        q->arrange(w, ArrangeSelectionMode::NewItemsOnly);
+        w.wait_for_idle();
+    }
+
     notification_manager->close_notification_of_type(NotificationType::UpdatedItemsInfo);
     for (const size_t idx : obj_idxs) {
         wxGetApp().obj_list()->add_object_to_list(idx, call_selection_changed);
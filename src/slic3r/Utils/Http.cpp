@@ -6,8 +6,10 @@
 ///|/
 #include "Http.hpp"
 
+#include <atomic>
 #include <cstdlib>
 #include <functional>
+#include <mutex>
 #include <thread>
 #include <deque>
 #include <sstream>
@@ -39,6 +41,9 @@ namespace Slic3r {
 
 // Private
 
+// Global upload bandwidth cap in bytes per second, zero means no limit. See Http::set_max_send_speed().
+static std::atomic<size_t> s_max_send_speed { 0 };
+
 struct CurlGlobalInit
 {
     static std::unique_ptr<CurlGlobalInit> instance;
@@ -108,6 +113,53 @@ struct CurlGlobalInit
 
 std::unique_ptr<CurlGlobalInit> CurlGlobalInit::instance;
 
+// Process-wide curl share handle keeping the DNS cache, TLS session cache and the
+// keep-alive connection pool alive across Http instances. Each request still runs on
+// its own easy handle, but repeated calls to the same host (print host connection
+// test, status queries, the upload queue) reuse an established connection instead of
+// re-resolving and re-handshaking every time.
+struct CurlShareInit
+{
+	::CURLSH   *share { nullptr };
+	std::mutex  locks[CURL_LOCK_DATA_LAST];
+
+	CurlShareInit()
+	{
+		share = ::curl_share_init();
+		if (share == nullptr) {
+			BOOST_LOG_TRIVIAL(error) << "CURL share init has failed, connections will not be reused.";
+			return;
+		}
+		::curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+		::curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lock_cb);
+		::curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlock_cb);
+		::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+		// Sharing of the connection cache is only available since curl 7.57.
+		::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+	}
+
+	~CurlShareInit()
+	{
+		if (share != nullptr)
+			::curl_share_cleanup(share);
+	}
+
+	static CurlShareInit& get()
+	{
+		static CurlShareInit instance;
+		return instance;
+	}
+
+private:
+	static void lock_cb(::CURL *, curl_lock_data data, curl_lock_access, void *userptr)
+		{ static_cast<CurlShareInit*>(userptr)->locks[data].lock(); }
+	static void unlock_cb(::CURL *, curl_lock_data data, void *userptr)
+		{ static_cast<CurlShareInit*>(userptr)->locks[data].unlock(); }
+};
+
 struct Http::priv
 {
 	enum {
@@ -181,6 +233,8 @@ Http::priv::priv(const std::string &url)
 	::curl_easy_setopt(curl, CURLOPT_USERAGENT, SLIC3R_APP_NAME "/" SLIC3R_VERSION);
 	::curl_easy_setopt(curl, CURLOPT_ERRORBUFFER, &error_buffer.front());
 	::curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+	if (::CURLSH *share = CurlShareInit::get().share; share != nullptr)
+		::curl_easy_setopt(curl, CURLOPT_SHARE, share);
 }
 
 Http::priv::~priv()
@@ -377,6 +431,10 @@ void Http::priv::http_perform(const HttpRetryOpt& retry_opts)
 
 	::curl_easy_setopt(curl, CURLOPT_VERBOSE, get_logging_level() >= 5);
 
+	if (curl_off_t speed = curl_off_t(s_max_send_speed.load(std::memory_order_relaxed)); speed > 0) {
+		::curl_easy_setopt(curl, CURLOPT_MAX_SEND_SPEED_LARGE, speed);
+	}
+
 	if (headerlist != nullptr) {
 		::curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerlist);
 	}
@@ -724,6 +782,11 @@ bool Http::ca_file_supported()
     return res;
 }
 
+void Http::set_max_send_speed(size_t bytes_per_second)
+{
+	s_max_send_speed.store(bytes_per_second, std::memory_order_relaxed);
+}
+
 std::string Http::tls_global_init()
 {
     if (!CurlGlobalInit::instance)
@@ -161,6 +161,11 @@ public:
 	// Tells whether current backend supports seting up a CA file using ca_file()
 	static bool ca_file_supported();
 
+	// Sets a global upper limit on the upload bandwidth in bytes per second,
+	// applied to every request performed from then on. Zero (the default) means no limit.
+	// Thread safe.
+	static void set_max_send_speed(size_t bytes_per_second);
+
     // Return empty string on success or error message on fail.
     static std::string tls_global_init();
     static std::string tls_system_cert_store();
@@ -9,6 +9,9 @@
 ///|/
 #include "PrintHost.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <thread>
 #include <exception>
@@ -20,6 +23,7 @@
 #include <wx/app.h>
 #include <wx/arrstr.h>
 
+#include "libslic3r/AppConfig.hpp"
 #include "libslic3r/PrintConfig.hpp"
 #include "libslic3r/Channel.hpp"
 #include "OctoPrint.hpp"
@@ -30,6 +34,7 @@
 #include "MKS.hpp"
 #include "Moonraker.hpp"
 #include "PrusaConnect.hpp"
+#include "../GUI/GUI_App.hpp"
 #include "../GUI/PrintHostDialogs.hpp"
 
 namespace fs = boost::filesystem;
@@ -91,35 +96,41 @@ wxString PrintHost::format_error(const std::string &body, const std::string &err
 
 struct PrintHostJobQueue::priv
 {
-    // XXX: comment on how bg thread works
+    // Jobs are picked up from channel_jobs by a small pool of background worker threads,
+    // so uploads to multiple hosts run concurrently. Job ids are assigned in enqueue()
+    // and match the row indices of the queue dialog.
 
     PrintHostJobQueue *q;
 
     Channel<PrintHostJob> channel_jobs;
     Channel<size_t> channel_cancels;
+    // The id the next enqueued job will receive.
     size_t job_id = 0;
-    int prev_progress = -1;
-    fs::path source_to_remove;
 
-    std::thread bg_thread;
-    bool bg_exit = false;
+    static constexpr size_t max_workers = 4;
+    std::vector<std::thread> workers;
+    std::atomic<bool> bg_exit { false };
+
+    // Ids of the jobs currently being uploaded by the workers, guarded by active_jobs_mutex.
+    std::set<size_t> active_jobs;
+    std::mutex active_jobs_mutex;
 
     PrintHostQueueDialog *queue_dialog;
 
     priv(PrintHostJobQueue *q) : q(q) {}
 
-    void emit_progress(int progress);
-    void emit_error(wxString error);
+    void emit_progress(size_t id, int progress);
+    void emit_error(size_t id, wxString error);
     void emit_cancel(size_t id);
-    void emit_info(wxString tag, wxString status);
+    void emit_info(size_t id, wxString tag, wxString status);
     void start_bg_thread();
     void stop_bg_thread();
     void bg_thread_main();
-    void progress_fn(Http::Progress progress, bool &cancel);
-    void error_fn(wxString error);
-    void info_fn(wxString tag, wxString status);
+    bool is_active_elsewhere(size_t cancel_id, size_t own_id);
+    void progress_fn(size_t id, int &prev_progress, Http::Progress progress, bool &cancel);
+    void error_fn(size_t id, wxString error);
+    void info_fn(size_t id, wxString tag, wxString status);
     void remove_source(const fs::path &path);
-    void remove_source();
     void perform_job(PrintHostJob the_job);
 };
 
@@ -134,21 +145,21 @@ PrintHostJobQueue::~PrintHostJobQueue()
     if (p) { p->stop_bg_thread(); }
 }
 
-void PrintHostJobQueue::priv::emit_progress(int progress)
+void PrintHostJobQueue::priv::emit_progress(size_t id, int progress)
 {
-    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_PROGRESS, queue_dialog->GetId(), job_id, progress);
+    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_PROGRESS, queue_dialog->GetId(), id, progress);
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::emit_error(wxString error)
+void PrintHostJobQueue::priv::emit_error(size_t id, wxString error)
 {
-    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_ERROR, queue_dialog->GetId(), job_id, std::move(error));
+    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_ERROR, queue_dialog->GetId(), id, std::move(error));
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::emit_info(wxString tag, wxString status)
+void PrintHostJobQueue::priv::emit_info(size_t id, wxString tag, wxString status)
 {
-    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_INFO, queue_dialog->GetId(), job_id, std::move(tag), std::move(status));
+    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_INFO, queue_dialog->GetId(), id, std::move(tag), std::move(status));
     wxQueueEvent(queue_dialog, evt);
 }
 
@@ -160,68 +171,88 @@ void PrintHostJobQueue::priv::emit_cancel(size_t id)
 
 void PrintHostJobQueue::priv::start_bg_thread()
 {
-    if (bg_thread.joinable()) { return; }
+    // One worker is spawned per enqueued job until the pool is full,
+    // idle workers just sleep on the job channel.
+    if (workers.size() >= max_workers) { return; }
 
     std::shared_ptr<priv> p2 = q->p;
-    bg_thread = std::thread([p2]() {
+    workers.emplace_back([p2]() {
         p2->bg_thread_main();
     });
 }
 
 void PrintHostJobQueue::priv::stop_bg_thread()
 {
-    if (bg_thread.joinable()) {
-        bg_exit = true;
-        channel_jobs.push(PrintHostJob()); // Push an empty job to wake up bg_thread in case it's sleeping
-        bg_thread.detach();                // Let the background thread go, it should exit on its own
+    bg_exit = true;
+    for (std::thread &worker : workers) {
+        if (worker.joinable()) {
+            channel_jobs.push(PrintHostJob()); // Push an empty job to wake up the worker in case it's sleeping
+            worker.detach();                   // Let the background thread go, it should exit on its own
+        }
     }
 }
 
 void PrintHostJobQueue::priv::bg_thread_main()
 {
-    // bg thread entry point
-
-    try {
-        // Pick up jobs from the job channel:
-        while (! bg_exit) {
-            auto job = channel_jobs.pop();   // Sleeps in a cond var if there are no jobs
-            if (job.empty()) {
-                // This happens when the thread is being stopped
-                break;
-            }
+    // worker thread entry point
+
+    // Pick up jobs from the job channel:
+    while (! bg_exit) {
+        auto job = channel_jobs.pop();   // Sleeps in a cond var if there are no jobs
+        if (job.empty()) {
+            // This happens when the thread is being stopped
+            break;
+        }
 
-            source_to_remove = job.upload_data.source_path;
+        const size_t id = job.id;
+        fs::path source_to_remove = job.upload_data.source_path;
 
-            BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue/bg_thread: Received job: [%1%]: `%2%` -> `%3%`, cancelled: %4%")
-                % job_id
-                % job.upload_data.upload_path
-                % job.printhost->get_host()
-                % job.cancelled;
+        BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue/bg_thread: Received job: [%1%]: `%2%` -> `%3%`, cancelled: %4%")
+            % id
+            % job.upload_data.upload_path
+            % job.printhost->get_host()
+            % job.cancelled;
 
-            if (! job.cancelled) {
+        if (! job.cancelled) {
+            {
+                std::lock_guard<std::mutex> lock(active_jobs_mutex);
+                active_jobs.insert(id);
+            }
+            try {
                 perform_job(std::move(job));
+            } catch (const std::exception &e) {
+                emit_error(id, e.what());
+            }
+            {
+                std::lock_guard<std::mutex> lock(active_jobs_mutex);
+                active_jobs.erase(id);
             }
-
-            remove_source();
-            job_id++;
         }
-    } catch (const std::exception &e) {
-        emit_error(e.what());
+
+        remove_source(source_to_remove);
     }
 
     // Cleanup leftover files, if any
-    remove_source();
     auto jobs = channel_jobs.lock_rw();
     for (const PrintHostJob &job : *jobs) {
         remove_source(job.upload_data.source_path);
     }
+    jobs->clear();
 }
 
-void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
+// Tells whether the cancel id belongs to a job being uploaded right now by another worker.
+// Such ids are left in the cancel channel for the owning worker's progress callback.
+bool PrintHostJobQueue::priv::is_active_elsewhere(size_t cancel_id, size_t own_id)
+{
+    std::lock_guard<std::mutex> lock(active_jobs_mutex);
+    return cancel_id != own_id && active_jobs.find(cancel_id) != active_jobs.end();
+}
+
+void PrintHostJobQueue::priv::progress_fn(size_t id, int &prev_progress, Http::Progress progress, bool &cancel)
 {
     if (cancel) {
         // When cancel is true from the start, Http indicates request has been cancelled
-        emit_cancel(job_id);
+        emit_cancel(id);
         return;
     }
 
@@ -235,32 +266,34 @@ void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
         auto cancels = channel_cancels.lock_rw();
         auto jobs = channel_jobs.lock_rw();
 
-        for (size_t cancel_id : *cancels) {
-            if (cancel_id == job_id) {
+        for (auto it = cancels->begin(); it != cancels->end(); ) {
+            const size_t cancel_id = *it;
+            if (cancel_id == id) {
                 cancel = true;
-            } else if (cancel_id > job_id) {
-                const size_t idx = cancel_id - job_id - 1;
-                if (idx < jobs->size()) {
-                    jobs->at(idx).cancelled = true;
-                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
-                    emit_cancel(cancel_id);
+            } else {
+                for (PrintHostJob &pending : *jobs) {
+                    if (pending.id == cancel_id && ! pending.cancelled) {
+                        pending.cancelled = true;
+                        BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
+                        emit_cancel(cancel_id);
+                        break;
+                    }
                 }
             }
+            it = is_active_elsewhere(cancel_id, id) ? std::next(it) : cancels->erase(it);
         }
-
-        cancels->clear();
     }
 
     if (! cancel) {
         int gui_progress = progress.ultotal > 0 ? 100*progress.ulnow / progress.ultotal : 0;
         if (gui_progress != prev_progress) {
-            emit_progress(gui_progress);
+            emit_progress(id, gui_progress);
             prev_progress = gui_progress;
         }
     }
 }
 
-void PrintHostJobQueue::priv::error_fn(wxString error)
+void PrintHostJobQueue::priv::error_fn(size_t id, wxString error)
 {
     // check if transfer was not canceled before error occured - than do not show the error
     bool do_emit_err = true;
@@ -269,29 +302,31 @@ void PrintHostJobQueue::priv::error_fn(wxString error)
         auto cancels = channel_cancels.lock_rw();
         auto jobs = channel_jobs.lock_rw();
 
-        for (size_t cancel_id : *cancels) {
-            if (cancel_id == job_id) {
+        for (auto it = cancels->begin(); it != cancels->end(); ) {
+            const size_t cancel_id = *it;
+            if (cancel_id == id) {
                 do_emit_err = false;
-                emit_cancel(job_id);
-            }
-            else if (cancel_id > job_id) {
-                const size_t idx = cancel_id - job_id - 1;
-                if (idx < jobs->size()) {
-                    jobs->at(idx).cancelled = true;
-                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
-                    emit_cancel(cancel_id);
+                emit_cancel(id);
+            } else {
+                for (PrintHostJob &pending : *jobs) {
+                    if (pending.id == cancel_id && ! pending.cancelled) {
+                        pending.cancelled = true;
+                        BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
+                        emit_cancel(cancel_id);
+                        break;
+                    }
                 }
             }
+            it = is_active_elsewhere(cancel_id, id) ? std::next(it) : cancels->erase(it);
         }
-        cancels->clear();
     }
     if (do_emit_err)
-        emit_error(std::move(error));
+        emit_error(id, std::move(error));
 }
 
-void PrintHostJobQueue::priv::info_fn(wxString tag, wxString status)
+void PrintHostJobQueue::priv::info_fn(size_t id, wxString tag, wxString status)
 {
-    emit_info(tag, status);
+    emit_info(id, tag, status);
 }
 
 void PrintHostJobQueue::priv::remove_source(const fs::path &path)
@@ -305,30 +340,32 @@ void PrintHostJobQueue::priv::remove_source(const fs::path &path)
     }
 }
 
-void PrintHostJobQueue::priv::remove_source()
-{
-    remove_source(source_to_remove);
-    source_to_remove.clear();
-}
-
 void PrintHostJobQueue::priv::perform_job(PrintHostJob the_job)
 {
-    emit_progress(0);   // Indicate the upload is starting
+    const size_t id = the_job.id;
+    emit_progress(id, 0);   // Indicate the upload is starting
 
+    int prev_progress = -1;
     bool success = the_job.printhost->upload(std::move(the_job.upload_data),
-        [this](Http::Progress progress, bool &cancel)   { this->progress_fn(std::move(progress), cancel); },
-        [this](wxString error)                          { this->error_fn(std::move(error)); },
-        [this](wxString tag, wxString host)             { this->info_fn(std::move(tag), std::move(host)); }
+        [this, id, &prev_progress](Http::Progress progress, bool &cancel) { this->progress_fn(id, prev_progress, std::move(progress), cancel); },
+        [this, id](wxString error)                                        { this->error_fn(id, std::move(error)); },
+        [this, id](wxString tag, wxString host)                           { this->info_fn(id, std::move(tag), std::move(host)); }
     );
 
     if (success) {
-        emit_progress(100);
+        emit_progress(id, 100);
     }
 }
 
 void PrintHostJobQueue::enqueue(PrintHostJob job)
 {
+    // Optional operator-side cap on the upload bandwidth, in kilobytes per second,
+    // shared by all the uploads in flight.
+    if (const std::string cap = GUI::get_app_config()->get("printhost_upload_speed_cap"); ! cap.empty())
+        Http::set_max_send_speed(std::atol(cap.c_str()) * 1024);
+
     p->start_bg_thread();
+    job.id = p->job_id ++;
     p->queue_dialog->append_job(job);
     p->channel_jobs.push(std::move(job));
 }
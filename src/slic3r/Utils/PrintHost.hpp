@@ -88,6 +88,8 @@ struct PrintHostJob
 {
     PrintHostUpload upload_data;
     std::unique_ptr<PrintHost> printhost;
+    // Assigned by PrintHostJobQueue::enqueue(), matches the row index in the queue dialog.
+    size_t id = 0;
     bool cancelled = false;
 
     PrintHostJob() {}
@@ -95,6 +97,7 @@ struct PrintHostJob
     PrintHostJob(PrintHostJob &&other)
         : upload_data(std::move(other.upload_data))
         , printhost(std::move(other.printhost))
+        , id(other.id)
         , cancelled(other.cancelled)
     {}
 
@@ -107,6 +110,7 @@ struct PrintHostJob
     {
         upload_data = std::move(other.upload_data);
         printhost = std::move(other.printhost);
+        id = other.id;
         cancelled = other.cancelled;
         return *this;
     }
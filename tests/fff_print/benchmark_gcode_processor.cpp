@@ -0,0 +1,40 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark_all.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/cstdio.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include "libslic3r/GCode/GCodeProcessor.hpp"
+#include "libslic3r/Print.hpp"
+
+#include "test_data.hpp"
+
+using namespace Slic3r;
+
+// Performance tracking of the g-code time estimator & preview preprocessing over a pinned print.
+// Hidden from the default test run by the dotted tag, run explicitly, optionally with
+//   fff_print_tests "[.Benchmarks]" --reporter JSON::out=benchmarks.json
+TEST_CASE("GCodeProcessor benchmarks", "[GCodeProcessor][.Benchmarks]") {
+    Print print;
+    Model model;
+    Test::init_print({TestMesh::cube_20x20x20}, print, model, { { "layer_height", 0.1 } });
+    const std::string gcode = Test::gcode(print);
+
+    boost::filesystem::path gcode_path = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("gcode_processor_benchmark_%%%%.gcode");
+    {
+        boost::nowide::ofstream out(gcode_path.string());
+        out << gcode;
+    }
+
+    BENCHMARK_ADVANCED("process_file 20mm cube")(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&] {
+            GCodeProcessor processor;
+            processor.process_file(gcode_path.string());
+            return processor.get_result().moves.size();
+        });
+    };
+
+    boost::nowide::remove(gcode_path.string().c_str());
+}
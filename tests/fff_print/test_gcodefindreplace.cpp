@@ -48,6 +48,17 @@ SCENARIO("Find/Replace with plain text", "[GCodeFindReplace]") {
             GCodeFindReplace find_replace({ "move UP", "move down", "", "" });
             REQUIRE(find_replace.process_layer(gcode) == gcode);
         }
+        WHEN("Replace \"G1 X13\" with \"G0 X13\", multiple occurrences, case sensitive") {
+            GCodeFindReplace find_replace({ "G1 X13", "G0 X13", "", "" });
+            REQUIRE(find_replace.process_layer(gcode) ==
+                "G1 Z0; home\n"
+                "G1 Z1; move up\n"
+                "G1 X0 Y1 Z1; perimeter\n"
+                // substituted
+                "G0 X13 Y32 Z1; infill\n"
+                // substituted
+                "G0 X13 Y32 Z1; wipe\n");
+        }
 
         // Whole word
         WHEN("Replace \"move up\" with \"move down\", whole word") {
@@ -63,3 +63,99 @@ SCENARIO("Model construction", "[Model]") {
         }
     }
 }
+
+SCENARIO("Model::merge_duplicate_objects", "[Model]") {
+    auto add_cube_object = [](Slic3r::Model &model, const Vec3d &offset) {
+        Slic3r::ModelObject *object = model.add_object();
+        object->name = "cube";
+        object->add_volume(Slic3r::make_cube(20., 20., 20.));
+        object->add_instance()->set_offset(offset);
+        return object;
+    };
+    GIVEN("A model with two identical cube objects at different positions") {
+        Slic3r::Model model;
+        Slic3r::ModelObject *a = add_cube_object(model, Vec3d(10., 10., 0.));
+        Slic3r::ModelObject *b = add_cube_object(model, Vec3d(50., 10., 0.));
+        WHEN("Duplicates are merged") {
+            size_t removed = model.merge_duplicate_objects();
+            THEN("One object is removed and the other carries both instances") {
+                REQUIRE(removed == 1);
+                REQUIRE(model.objects.size() == 1);
+                REQUIRE(model.objects.front() == a);
+                REQUIRE(model.objects.front()->instances.size() == 2);
+            }
+            THEN("The world placement of the duplicate is preserved") {
+                REQUIRE(model.objects.front()->instances[1]->get_offset().isApprox(Vec3d(50., 10., 0.)));
+            }
+        }
+        WHEN("A volume of one copy is translated") {
+            b->volumes.front()->set_offset(b->volumes.front()->get_offset() + Vec3d(0., 0., 1.));
+            THEN("The near-duplicates are not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+        WHEN("One copy carries a different object config") {
+            b->config.set_key_value("fill_density", new ConfigOptionPercent(42));
+            THEN("The objects are not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+        WHEN("One copy carries a different volume config") {
+            b->volumes.front()->config.set_key_value("extruder", new ConfigOptionInt(2));
+            THEN("The objects are not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+        WHEN("One copy has painted support enforcers") {
+            b->volumes.front()->supported_facets.set_triangle_from_string(0, "4");
+            THEN("The painted object is not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+        WHEN("One copy is a result of a cut") {
+            b->cut_id.init();
+            THEN("The cut object is not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+        WHEN("One copy has a custom layer range") {
+            b->layer_config_ranges[t_layer_height_range(0., 0.4)];
+            THEN("The object with custom layering is not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+        WHEN("One copy has SLA support points") {
+            b->sla_support_points.emplace_back();
+            THEN("The object with SLA points is not merged") {
+                REQUIRE(model.merge_duplicate_objects() == 0);
+                REQUIRE(model.objects.size() == 2);
+            }
+        }
+    }
+    GIVEN("A model with three identical cubes and one scaled cube") {
+        Slic3r::Model model;
+        add_cube_object(model, Vec3d(10., 10., 0.));
+        add_cube_object(model, Vec3d(50., 10., 0.));
+        add_cube_object(model, Vec3d(90., 10., 0.));
+        Slic3r::ModelObject *big = model.add_object();
+        big->name = "big cube";
+        big->add_volume(Slic3r::make_cube(30., 30., 30.));
+        big->add_instance()->set_offset(Vec3d(10., 50., 0.));
+        WHEN("Duplicates are merged") {
+            size_t removed = model.merge_duplicate_objects();
+            THEN("The identical cubes collapse into one object, the scaled cube stays") {
+                REQUIRE(removed == 2);
+                REQUIRE(model.objects.size() == 2);
+                REQUIRE(model.objects.front()->instances.size() == 3);
+                REQUIRE(model.objects.back() == big);
+                REQUIRE(model.objects.back()->instances.size() == 1);
+            }
+        }
+    }
+}
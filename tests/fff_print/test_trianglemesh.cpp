@@ -280,6 +280,46 @@ SCENARIO( "TriangleMesh: Mesh merge functions") {
     }
 }
 
+SCENARIO( "TriangleMeshSlicer: Incremental re-slice with MeshSliceCache.") {
+    GIVEN( "A 20mm cube with one corner on the origin") {
+        auto cube = make_cube();
+        MeshSlicingParamsEx params;
+        MeshSliceCache      cache;
+        std::vector<float>  zs { 2.f, 6.f, 10.f, 14.f, 18.f };
+        std::vector<ExPolygons> reference = slice_mesh_ex(cube.its, zs, params);
+        std::vector<ExPolygons> cached    = slice_mesh_ex(cube.its, zs, params, cache);
+        WHEN( "The mesh is re-sliced with the same Z vector") {
+            std::vector<ExPolygons> resliced = slice_mesh_ex(cube.its, zs, params, cache);
+            THEN( "The result matches a from-scratch slice.") {
+                REQUIRE(resliced == reference);
+            }
+        }
+        WHEN( "A layer is inserted into the Z vector") {
+            std::vector<float> zs2 { 2.f, 6.f, 8.f, 10.f, 14.f, 18.f };
+            std::vector<ExPolygons> resliced = slice_mesh_ex(cube.its, zs2, params, cache);
+            THEN( "The result matches a from-scratch slice over the new Z vector.") {
+                REQUIRE(resliced == slice_mesh_ex(cube.its, zs2, params));
+            }
+        }
+        WHEN( "The slicing parameters change") {
+            MeshSlicingParamsEx params2 = params;
+            params2.closing_radius = 0.2f;
+            std::vector<ExPolygons> resliced = slice_mesh_ex(cube.its, zs, params2, cache);
+            THEN( "The cache is not reused and the result matches a from-scratch slice.") {
+                REQUIRE(resliced == slice_mesh_ex(cube.its, zs, params2));
+            }
+        }
+        WHEN( "The mesh geometry changes without changing the vertex and face counts") {
+            auto cube2 = cube;
+            cube2.its.vertices.back().z() += 5.f;
+            std::vector<ExPolygons> resliced = slice_mesh_ex(cube2.its, zs, params, cache);
+            THEN( "The stale cache is not reused and the result matches a from-scratch slice.") {
+                REQUIRE(resliced == slice_mesh_ex(cube2.its, zs, params));
+            }
+        }
+    }
+}
+
 SCENARIO( "TriangleMeshSlicer: Cut behavior.") {
     GIVEN( "A 20mm cube with one corner on the origin") {
 		auto cube = make_cube();
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark_all.hpp>
+
+#include <memory>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/ClipperUtils.hpp"
+#include "libslic3r/ExtrusionEntity.hpp"
+#include "libslic3r/Fill/FillBase.hpp"
+#include "libslic3r/Point.hpp"
+#include "libslic3r/ShortestPath.hpp"
+#include "libslic3r/Surface.hpp"
+#include "libslic3r/TriangleMesh.hpp"
+#include "libslic3r/TriangleMeshSlicer.hpp"
+
+#include "../data/prusaparts.hpp"
+
+using namespace Slic3r;
+
+// Performance tracking of libslic3r hot kernels over pinned inputs.
+// The benchmarks are hidden from the default test run by the dotted tag, run them explicitly,
+// optionally with a machine readable report for trend tracking between releases:
+//   libslic3r_tests "[.Benchmarks]" --reporter JSON::out=benchmarks.json
+TEST_CASE("Hot kernel benchmarks", "[Kernels][.Benchmarks]") {
+    const TriangleMesh sphere = make_sphere(30., 2 * PI / 200.);
+
+    {
+        std::vector<float> zs;
+        for (float z = 0.1f; z < 60.f; z += 0.15f)
+            zs.emplace_back(z);
+        BENCHMARK("slice_mesh_ex sphere") {
+            return slice_mesh_ex(sphere.its, zs);
+        };
+    }
+
+    {
+        const ExPolygons parts = union_ex(PRUSA_PART_POLYGONS);
+        BENCHMARK("offset_ex prusa parts grow") {
+            return offset_ex(parts, scaled<float>(0.5));
+        };
+        BENCHMARK("offset_ex prusa parts shrink") {
+            return offset_ex(parts, - scaled<float>(0.5));
+        };
+    }
+
+    {
+        // Short infill lines scattered deterministically over the bed.
+        ExtrusionPaths paths;
+        paths.reserve(1000);
+        for (size_t i = 0; i < 1000; ++ i) {
+            ExtrusionPath path{ ExtrusionAttributes{ ExtrusionRole::InternalInfill, ExtrusionFlow{ 1., 0.4f, 0.2f } } };
+            const Point a = Point::new_scale(double((i * 613) % 1000) / 10., double((i * 389) % 1000) / 10.);
+            path.polyline.append(a);
+            path.polyline.append(a + Point::new_scale(3., 1.));
+            paths.emplace_back(std::move(path));
+        }
+        std::vector<ExtrusionEntity*> entities;
+        entities.reserve(paths.size());
+        for (ExtrusionPath &path : paths)
+            entities.emplace_back(&path);
+        BENCHMARK("chain_extrusion_entities 1000 infill lines") {
+            return chain_extrusion_entities(entities);
+        };
+    }
+
+    {
+        std::unique_ptr<Fill> filler(Fill::new_from_type("rectilinear"));
+        filler->spacing = 0.45;
+        FillParams fill_params;
+        fill_params.density     = 1.f;
+        fill_params.dont_adjust = true;
+        const ExPolygon square{ Point::new_scale(0., 0.), Point::new_scale(100., 0.), Point::new_scale(100., 100.), Point::new_scale(0., 100.) };
+        const Surface   surface(stInternalSolid, square);
+        BENCHMARK("FillRectilinear solid 100x100 square") {
+            return filler->fill_surface(&surface, fill_params);
+        };
+    }
+
+    {
+        Transform3d trafo = Transform3d::Identity();
+        trafo.rotate(Eigen::AngleAxisd(0.5, Vec3d(1., 2., 3.).normalized()));
+        trafo.scale(1.1);
+        BENCHMARK_ADVANCED("TriangleMesh transform sphere")(Catch::Benchmark::Chronometer meter) {
+            std::vector<TriangleMesh> meshes(meter.runs(), sphere);
+            meter.measure([&](int i) { meshes[i].transform(trafo); });
+        };
+    }
+}
@@ -174,6 +174,60 @@ SCENARIO("Various Clipper operations - xs/t/11_clipper.t", "[ClipperUtils]") {
 #endif
 }
 
+SCENARIO("union_ex_disjoint", "[ClipperUtils]") {
+    GIVEN("a grid of disjoint squares and one overlapping pair") {
+        Polygons subject;
+        // 3x3 grid of disjoint 100x100 squares with 100 units of spacing.
+        for (coord_t ix = 0; ix < 3; ++ ix)
+            for (coord_t iy = 0; iy < 3; ++ iy) {
+                Slic3r::Polygon square { { 0, 0 }, { 100, 0 }, { 100, 100 }, { 0, 100 } };
+                square.translate(ix * 200, iy * 200);
+                subject.emplace_back(std::move(square));
+            }
+        // Two overlapping squares, off to the side of the grid.
+        subject.emplace_back(Slic3r::Polygon { { 1000, 0 }, { 1100, 0 }, { 1100, 100 }, { 1000, 100 } });
+        subject.emplace_back(Slic3r::Polygon { { 1050, 0 }, { 1150, 0 }, { 1150, 100 }, { 1050, 100 } });
+        WHEN("union_ex_disjoint") {
+            ExPolygons result = Slic3r::union_ex_disjoint(subject);
+            THEN("it is equivalent to the full union_ex") {
+                ExPolygons reference = Slic3r::union_ex(subject);
+                REQUIRE(result.size() == reference.size());
+                auto total_area = [](const ExPolygons &expolygons) {
+                    double area = 0.;
+                    for (const ExPolygon &expolygon : expolygons)
+                        area += expolygon.area();
+                    return area;
+                };
+                REQUIRE(total_area(result) == Approx(total_area(reference)));
+            }
+        }
+    }
+}
+
+SCENARIO("Batch morphological closing / opening", "[ClipperUtils]") {
+    GIVEN("two independent polygon sets") {
+        Slic3r::Polygons set1 { Slic3r::Polygon { { 200, 100 }, { 200, 200 }, { 100, 200 }, { 100, 100 } } };
+        Slic3r::Polygons set2 { Slic3r::Polygon { { 4000, 1000 }, { 4000, 4000 }, { 1000, 4000 }, { 1000, 1000 } } };
+        WHEN("closing_ex batch") {
+            std::vector<ExPolygons> batch = Slic3r::closing_ex(std::vector<Polygons> { set1, set2 }, 10.f);
+            THEN("every slot matches the per-set call") {
+                REQUIRE(batch.size() == 2);
+                REQUIRE(batch[0] == Slic3r::closing_ex(set1, 10.f));
+                REQUIRE(batch[1] == Slic3r::closing_ex(set2, 10.f));
+            }
+        }
+        WHEN("opening_ex batch") {
+            std::vector<ExPolygons> sets { union_ex(set1), union_ex(set2) };
+            std::vector<ExPolygons> batch = Slic3r::opening_ex(sets, 10.f);
+            THEN("every slot matches the per-set call") {
+                REQUIRE(batch.size() == 2);
+                REQUIRE(batch[0] == Slic3r::opening_ex(sets[0], 10.f));
+                REQUIRE(batch[1] == Slic3r::opening_ex(sets[1], 10.f));
+            }
+        }
+    }
+}
+
 SCENARIO("Various Clipper operations - t/clipper.t", "[ClipperUtils]") {
     GIVEN("square with hole") {
         // CCW oriented contour
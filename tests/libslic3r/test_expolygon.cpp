@@ -68,6 +68,31 @@ SCENARIO("Basics", "[ExPolygon]") {
     }
 }
 
+SCENARIO("Simplify", "[ExPolygon]") {
+    GIVEN("ccw square with a hole, scaled coordinates") {
+        ExPolygon expolygon {
+            { { 0, 0 }, { 100000, 0 }, { 100000, 100000 }, { 0, 100000 } },
+            { { 30000, 30000 }, { 30000, 70000 }, { 70000, 70000 }, { 70000, 30000 } } };
+        WHEN("simplified with a tolerance that removes no vertex") {
+            ExPolygons simplified = expolygon.simplify(100.);
+            THEN("the expolygon is returned unchanged") {
+                REQUIRE(simplified.size() == 1);
+                REQUIRE(simplified.front() == expolygon);
+            }
+        }
+        WHEN("a collinear vertex is inserted into the contour") {
+            expolygon.contour.points.insert(expolygon.contour.points.begin() + 1, Point{ 50000, 0 });
+            ExPolygons simplified = expolygon.simplify(100.);
+            THEN("the collinear vertex is removed") {
+                REQUIRE(simplified.size() == 1);
+                REQUIRE(simplified.front().contour.size() == 4);
+                REQUIRE(simplified.front().holes.size() == 1);
+                REQUIRE(simplified.front().area() == Approx(expolygon.area()));
+            }
+        }
+    }
+}
+
 #include <sstream>
 #include <cereal/cereal.hpp>
 #include <cereal/archives/binary.hpp>